@@ -0,0 +1,64 @@
+// Labelled positions for the training tools: a DatasetHeader followed by
+// PositionRecords, little endian. Written by selfplay, read by nnue_train
+// and tune.
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <cstring>
+#include <fstream>
+#include <string>
+
+const char DATASET_MAGIC[8] = {'O','T','H','E','L','L','D','S'};
+const unsigned int DATASET_VERSION = 2;
+
+struct DatasetHeader {
+    char magic[8];
+    unsigned int version;
+    unsigned int record_size;
+};
+// the board as two bitboards (bit x * 8 + y), then what the tools need to
+// know about it
+struct PositionRecord {
+    unsigned long long black, white;
+    // search score for the side to move, clamped to a short; a solved
+    // position scores its final disc difference times NNUE_DISC_VALUE
+    short score;
+    // 1 black, 2 white
+    unsigned char side;
+    // final disc difference for black
+    signed char result;
+    // game the position comes from, positions of one game are consecutive
+    unsigned int game;
+};
+
+// reads records in chunks, the whole file never has to fit in memory
+class DatasetReader {
+public:
+    bool open(const std::string& path){
+        in.close();
+        in.clear();
+        in.open(path,std::ios::binary);
+        DatasetHeader header;
+        return in.read(reinterpret_cast<char*>(&header),sizeof(header)) && \
+        memcmp(header.magic,DATASET_MAGIC,sizeof(DATASET_MAGIC)) == 0 && \
+        header.version == DATASET_VERSION && header.record_size == sizeof(PositionRecord);
+    }
+    // up to max records, 0 at the end of the file
+    size_t read(PositionRecord* out , size_t max){
+        in.read(reinterpret_cast<char*>(out),max * sizeof(PositionRecord));
+        return in.gcount() / sizeof(PositionRecord);
+    }
+private:
+    std::ifstream in;
+};
+
+inline bool dataset_write_header(std::ostream& out){
+    DatasetHeader header;
+    memcpy(header.magic,DATASET_MAGIC,sizeof(DATASET_MAGIC));
+    header.version = DATASET_VERSION;
+    header.record_size = sizeof(PositionRecord);
+    out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+    return (bool)out;
+}
+
+#endif
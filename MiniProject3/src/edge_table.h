@@ -0,0 +1,831 @@
+// Generated by edge_table_gen.cpp, do not edit.
+// edge_table[side to move - 1][edge] is the value of an edge for black,
+// the edge read as a base 3 number from one corner to the other.
+const short edge_table[2][6561] = {
+{
+    8,210,-210,9,210,-210,85,210,-210,22,210,-210,17,210,-210,210,
+    57,-210,2,210,-57,3,210,-35,7,210,-210,27,76,-210,3,210,
+    -210,123,210,-210,32,210,-210,27,210,-210,210,73,-210,8,210,-210,
+    -210,76,-51,210,51,-210,-8,210,-76,-2,210,-51,210,210,-76,32,
+    210,-51,27,210,-29,210,73,-54,-8,210,-73,27,210,-51,-3,210,
+    -210,27,101,-210,14,101,-210,101,101,-210,32,101,-210,27,210,-210,
+    101,73,-210,8,60,-35,27,210,-35,60,210,-210,32,76,-210,27,
+    210,-210,60,210,-210,38,210,-210,33,210,-210,210,73,-210,27,210,
+    -210,-210,76,-19,210,51,-210,32,73,-210,27,210,-210,16,210,-210,
+    22,101,-51,-210,101,-13,101,57,-38,27,210,-210,-210,60,-35,210,
+    35,-210,-8,210,-60,-2,210,-101,-9,210,-101,-2,210,-60,-7,210,
+    -35,210,35,-60,-8,210,-73,-101,210,-35,210,210,-101,32,210,-73,
+    -16,210,-35,210,210,-60,38,210,-35,33,210,-35,210,73,-60,-22,
+    210,-35,-101,76,-19,210,51,-101,-27,210,-76,-26,210,-51,210,210,
+    -76,38,210,-51,33,210,-51,210,73,-76,-32,210,-73,33,210,-73,
+    -27,210,-210,22,85,-210,17,123,-210,123,123,-210,22,123,-210,17,
+    123,-210,123,57,-210,8,123,-51,-210,123,-35,123,123,-210,32,76,
+    -210,-210,123,-210,123,123,-210,38,123,-210,33,210,-210,123,73,-210,
+    8,123,-210,-210,76,-19,123,51,-210,-2,85,-210,-2,85,-29,85,
+    85,-54,38,85,-29,33,210,-29,85,73,-54,-8,44,-51,33,210,
+    -51,-3,210,-210,32,101,-210,14,101,-210,101,101,-210,38,101,-210,
+    33,210,-210,101,73,-210,8,60,-35,33,210,-35,13,210,-210,38,
+    76,-210,33,210,-210,32,210,-210,38,210,-210,33,210,-210,210,73,
+    -210,33,210,-210,-210,76,-19,210,51,-210,38,73,-210,33,210,-210,
+    16,210,-210,22,101,-13,-210,101,-13,101,57,-38,33,210,-210,-210,
+    60,-35,210,35,-210,32,85,-210,-2,85,-210,85,85,-210,38,85,
+    -210,33,210,-210,85,73,-210,-8,51,-51,33,210,-51,-3,210,-210,
+    22,44,-210,-210,123,-13,123,123,-38,22,123,-13,-210,123,-13,123,
+    57,-38,0,123,-13,-79,60,-35,123,35,-79,38,73,-210,33,210,
+    -210,0,210,-210,6,85,-29,-210,85,-29,85,41,-54,33,210,-210,
+    -210,44,-51,210,19,-210,2,210,-85,-85,210,-85,210,210,-85,8,
+    210,-44,3,210,-123,210,51,-123,-22,210,-57,3,210,-57,-17,210,
+    -123,8,210,-44,3,210,-85,2,210,-85,8,210,-44,3,210,-19,
+    210,51,-44,3,210,-85,-85,54,-41,210,29,-85,-8,210,-44,-123,
+    210,-51,210,210,-76,-8,210,-51,-123,210,-19,210,51,-44,-22,210,
+    -73,-123,210,-19,210,210,-123,8,210,-51,9,210,-85,2,210,-85,
+    8,210,-51,3,210,-19,210,51,-44,3,210,-73,-85,210,-19,210,
+    210,-85,27,210,-73,0,210,-19,210,210,-44,33,210,-19,28,210,
+    -19,210,51,-44,-6,210,-19,-85,54,-41,210,29,-85,-22,210,-44,
+    -123,210,-19,210,210,-44,0,79,-35,-123,79,-35,79,35,-60,-22,
+    210,-19,-123,38,-57,210,13,-123,-8,210,-60,-13,210,-101,-14,210,
+    -101,-8,210,-60,-13,210,-35,210,35,-60,-22,210,-73,-101,210,-35,
+    210,210,-101,27,210,-73,-16,210,-35,210,210,-60,33,210,-35,28,
+    210,-35,210,35,-60,-22,210,-35,-101,38,-57,210,13,-101,-32,210,
+    -76,-32,210,-51,210,210,-76,33,210,-51,28,210,-51,210,19,-76,
+    -38,210,-73,28,210,-73,-33,210,-210,9,55,-240,-10,55,-240,60,
+    30,-240,17,0,-240,12,115,-240,60,-180,-240,-85,14,-180,9,115,
+    -180,60,115,-240,14,33,-240,9,115,-240,60,115,-240,14,115,-240,
+    9,115,-240,115,-180,-240,9,115,-240,-240,-120,-180,115,-180,-240,-2,
+    -60,-240,-7,77,-120,-60,77,-180,-2,77,-120,-240,77,-120,77,-120,
+    -180,-13,60,-180,-240,60,-180,60,60,-240,3,-60,-240,9,74,-240,
+    60,49,-240,-210,-60,-240,-240,60,-240,60,-180,-240,3,33,-180,-240,
+    60,-180,60,60,-240,27,52,-240,-240,60,-240,60,60,-240,33,60,
+    -240,28,210,-240,60,-180,-240,0,60,-240,-240,-120,-180,60,-180,-240,
+    -16,-120,-240,-240,60,-240,60,60,-240,-210,-60,-120,-240,-60,-120,-60,
+    -120,-180,-16,60,-240,-240,-120,-180,60,-180,-240,-2,17,-240,-7,77,
+    -240,-27,77,-240,-2,77,-240,-7,77,-60,77,-60,-120,-123,36,-180,
+    -180,36,-60,0,11,-180,27,52,-240,-240,0,-60,27,0,-120,33,
+    0,-60,28,210,-60,0,-60,-120,-123,0,-60,-180,-60,-120,0,-120,
+    -180,-26,39,-240,-26,39,-120,-60,14,-180,33,-60,-120,28,210,-120,
+    -60,-120,-180,-32,-2,-180,28,210,-180,-27,210,-240,17,36,-240,12,
+    96,-240,0,96,-240,17,96,-240,12,96,-240,96,-180,-240,3,55,
+    -180,-240,55,-180,8,30,-240,27,52,-240,-240,0,-240,30,0,-240,
+    33,0,-240,28,210,-240,30,-180,-240,3,0,-240,-240,-120,-180,8,
+    -180,-240,-7,58,-240,-7,58,-120,-60,33,-180,33,-60,-120,28,210,
+    -120,-60,-120,-180,-13,17,-180,28,210,-180,-8,210,-240,27,74,-240,
+    9,74,-240,30,49,-240,33,-60,-240,28,210,-240,30,-180,-240,3,
+    33,-180,28,210,-180,8,210,-240,33,52,-240,28,210,-240,27,210,
+    -240,33,210,-240,28,210,-240,210,-180,-240,28,210,-240,-240,-120,-180,
+    210,-180,-240,33,-120,-240,28,210,-240,-60,210,-240,-210,-60,-120,-240,
+    -60,-120,-60,-120,-180,28,210,-240,-240,-120,-180,210,-180,-240,27,52,
+    -240,-240,-60,-240,27,-60,-240,33,-60,-240,28,210,-240,0,-180,-240,
+    -123,-120,-180,28,210,-180,-8,210,-240,-210,-120,-240,-240,0,-60,0,
+    0,-120,-210,0,-60,-240,0,-60,0,-60,-120,-123,0,-60,-180,-60,
+    -120,0,-120,-180,33,-120,-240,28,210,-240,-60,210,-240,-210,-60,-120,
+    -240,-60,-120,-60,-120,-180,28,210,-240,-240,-120,-180,210,-180,-240,3,
+    -60,-240,9,74,-240,-30,49,-240,-210,0,-240,-240,0,-240,30,-180,
+    -240,3,33,-180,-240,0,-180,8,0,-240,27,52,-240,-240,0,-240,
+    27,0,-240,33,0,-240,28,210,-240,8,-180,-240,-85,0,-240,-240,
+    -120,-180,0,-180,-240,-101,-60,-240,-180,-60,-120,-60,-60,-180,33,-60,
+    -120,28,210,-120,-60,-120,-180,-101,-120,-180,28,210,-180,-30,210,-240,
+    -210,-60,-120,-240,-60,-240,60,-60,-240,-210,-60,-120,-240,60,-24,60,
+    0,-60,-85,-60,-120,-240,60,-24,60,60,-120,-210,-120,-240,-240,60,
+    -24,60,60,-60,-210,60,-24,-240,60,-24,60,0,-60,-85,60,-24,
+    -120,0,-60,60,-60,-120,-101,-60,-120,-180,60,-24,60,60,-60,-79,
+    0,-60,-180,0,-60,0,-60,-120,-101,60,-24,-180,-60,-120,60,-120,
+    -180,27,52,-240,-240,-60,-240,27,-60,-240,33,-60,-240,28,210,-240,
+    -8,-180,-240,-123,-120,-180,28,210,-180,-30,210,-240,-210,-120,-240,-240,
+    0,-60,0,0,-120,-210,0,-60,-240,0,-60,0,-60,-120,-123,0,
+    -60,-180,-60,-120,0,-120,-180,33,-120,-240,28,210,-240,-60,210,-240,
+    -210,-60,-120,-240,-60,-120,-60,-120,-180,28,210,-240,-240,-120,-180,210,
+    -180,-240,85,240,60,60,240,-30,10,240,-55,123,240,-14,0,240,
+    0,240,180,0,210,240,180,-30,240,180,240,240,0,101,240,60,
+    60,240,60,240,240,60,101,240,120,30,240,-60,240,180,-60,2,
+    240,60,60,180,120,240,120,-77,-9,240,-33,-27,240,180,240,240,
+    120,85,240,180,27,240,180,240,180,120,-14,240,180,27,240,180,
+    -9,240,-115,123,240,-17,60,240,60,240,240,60,123,180,120,30,
+    240,-11,180,180,-36,2,240,60,27,240,180,7,240,-77,60,240,
+    120,60,240,-14,26,240,-39,32,240,2,27,240,180,240,180,120,
+    210,240,60,60,180,120,240,120,60,210,240,120,27,240,0,240,
+    240,0,123,180,120,0,180,120,180,120,60,210,240,0,0,120,
+    60,240,60,0,210,240,120,-60,240,60,240,240,60,85,240,60,
+    -60,240,180,240,180,120,210,240,180,-60,240,180,240,240,60,16,
+    240,120,60,240,180,240,240,120,16,240,180,-60,240,180,240,180,
+    120,210,240,180,60,180,120,240,120,60,210,240,120,-60,240,180,
+    240,240,120,0,240,180,-60,240,180,240,180,120,210,240,180,-60,
+    240,180,240,240,-60,210,240,60,60,240,60,240,240,60,123,240,
+    120,96,240,0,240,180,0,210,240,180,30,240,180,240,240,0,
+    101,240,120,60,240,60,180,240,60,101,240,120,30,240,180,240,
+    180,120,210,240,60,60,180,120,240,120,60,210,240,120,77,240,
+    180,240,240,120,85,240,180,0,240,180,240,180,120,210,240,180,
+    -8,240,180,240,240,0,210,240,120,115,240,60,240,240,60,123,
+    240,120,30,240,180,240,180,120,210,240,180,8,240,180,240,240,
+    60,210,240,120,60,240,180,240,240,120,210,240,180,210,240,180,
+    240,180,120,210,240,180,60,180,120,240,120,60,210,240,120,0,
+    240,180,240,240,120,123,180,120,0,180,120,180,120,60,210,240,
+    180,0,120,60,240,60,0,210,240,120,77,240,60,240,240,60,
+    85,240,60,-60,240,180,240,180,120,210,120,60,-60,240,180,240,
+    240,60,101,120,60,-60,180,120,180,180,60,101,180,120,-60,180,
+    120,180,120,60,79,180,120,0,120,60,180,60,0,210,240,120,
+    -60,240,180,240,240,120,85,120,60,-60,120,60,120,60,0,210,
+    240,180,-60,60,0,240,24,-60,7,240,-36,60,240,60,240,240,
+    60,123,240,120,8,240,-30,240,180,-55,-17,240,180,8,240,180,
+    -12,240,-96,60,240,120,60,240,-33,7,240,-58,13,240,-17,8,
+    240,180,240,180,120,210,240,60,60,180,120,240,120,60,210,240,
+    120,0,240,180,240,240,120,-3,240,180,-8,240,180,240,180,120,
+    210,240,180,-30,240,180,240,240,0,210,240,120,115,240,60,240,
+    240,60,123,240,120,8,240,180,240,180,120,210,240,180,0,240,
+    180,240,240,60,210,240,120,60,240,180,240,240,120,210,240,180,
+    210,240,180,240,180,120,210,240,180,60,180,120,240,120,60,210,
+    240,120,0,240,180,240,240,120,123,180,120,0,180,120,180,120,
+    60,210,240,180,0,120,60,240,60,0,-3,240,120,60,240,-49,
+    -9,240,-74,-3,240,-33,-8,240,180,240,180,120,210,240,180,-30,
+    240,180,240,240,60,210,240,120,60,240,180,240,240,120,210,240,
+    180,210,240,180,240,180,120,210,240,180,60,180,120,240,120,60,
+    -27,240,-52,-27,240,180,240,240,120,210,240,180,210,240,180,240,
+    180,120,-33,240,180,210,240,180,-28,240,-210,210,120,0,55,142,
+    0,240,142,0,85,142,0,36,142,-60,240,95,-60,210,139,6,
+    -60,139,6,240,139,-60,101,120,60,-60,139,-60,240,139,-60,101,
+    139,-60,74,180,-60,240,114,-60,210,139,-60,-60,117,22,240,92,
+    -60,210,180,3,17,120,0,240,120,-35,85,180,0,52,180,60,
+    240,98,3,210,120,-32,52,180,6,240,180,-60,76,120,35,33,
+    120,0,240,120,-3,76,120,0,52,180,0,240,92,0,210,79,
+    0,52,180,60,240,180,0,76,95,35,52,180,60,240,180,60,
+    76,180,120,52,180,-120,240,92,-120,210,180,60,-120,95,0,240,
+    70,-120,210,180,0,52,180,0,240,180,0,44,120,6,-120,120,
+    6,120,76,-19,210,180,0,-120,79,-16,240,54,-120,210,180,60,
+    -60,180,-60,240,120,-60,85,180,0,58,180,60,240,98,0,210,
+    120,-32,-60,180,60,240,180,-60,73,180,32,-120,180,60,240,180,
+    60,73,180,120,-120,180,60,240,76,0,210,180,60,-60,79,0,
+    240,54,-60,210,180,-35,39,180,0,240,180,-35,73,180,120,-120,
+    180,0,240,60,-35,210,180,-32,-120,180,-32,240,180,-120,210,142,
+    60,0,142,0,240,136,0,123,136,0,96,180,0,240,136,0,
+    210,101,0,0,180,60,240,180,0,101,120,60,-60,180,60,180,
+    180,60,101,180,120,-60,180,-60,240,0,-60,210,180,60,-60,60,
+    0,240,0,-60,210,180,0,77,142,60,240,120,0,85,180,120,
+    -60,180,60,240,60,0,210,101,0,-60,180,0,240,180,-60,210,
+    139,60,115,180,60,240,180,60,123,180,120,0,180,0,240,60,
+    0,210,139,60,0,180,60,240,180,0,210,180,120,60,180,60,
+    240,180,60,210,180,120,210,240,180,240,180,120,210,180,60,60,
+    180,120,240,120,60,210,180,120,0,180,0,240,180,0,123,60,
+    0,0,180,120,180,120,60,210,180,0,0,120,60,240,60,0,
+    210,180,60,77,180,60,240,120,60,85,180,120,-60,180,-60,240,
+    0,-60,210,120,60,-60,180,0,240,180,-60,101,120,60,-60,60,
+    0,180,60,-60,101,60,0,-60,180,120,180,120,60,79,60,0,
+    0,120,60,180,60,0,210,180,120,-60,180,-60,240,180,-60,85,
+    0,-60,-60,120,60,120,60,0,210,180,-60,-60,60,0,240,0,
+    -60,210,139,60,14,120,0,240,101,0,123,101,0,55,180,0,
+    240,95,0,210,60,0,33,139,60,240,139,0,60,79,0,33,
+    139,60,240,139,0,60,139,60,33,139,60,240,73,0,210,139,
+    60,-60,76,0,240,51,-60,210,120,0,36,120,60,240,120,0,
+    51,120,60,-120,120,60,120,60,0,210,120,60,-120,120,60,240,
+    120,-120,210,139,60,115,180,60,240,180,60,123,180,120,0,180,
+    60,240,60,0,210,139,60,0,120,60,240,120,0,210,180,120,
+    60,180,60,240,120,60,210,180,120,210,240,180,240,180,120,210,
+    120,60,60,180,120,240,120,60,210,180,120,0,120,60,240,120,
+    0,123,60,0,0,180,120,180,120,60,210,120,60,0,120,60,
+    240,60,0,210,120,60,60,180,60,240,120,60,44,101,0,17,
+    101,0,240,57,-60,210,120,60,-120,60,0,240,60,-120,210,180,
+    120,60,180,60,240,120,60,210,180,120,210,240,180,240,180,120,
+    210,120,60,60,180,120,240,120,60,210,180,120,-2,63,-60,240,
+    38,-120,210,180,120,210,240,180,240,180,120,210,22,-120,210,240,
+    180,240,240,-120,210,142,60,55,142,0,240,142,0,123,142,0,
+    96,180,0,240,136,0,210,120,6,74,180,60,240,180,0,101,
+    120,60,74,180,60,240,180,60,101,180,120,74,180,-60,240,114,
+    -60,210,180,60,-60,117,22,240,92,-60,210,180,3,77,180,60,
+    240,180,3,85,180,120,-60,180,60,240,98,3,210,180,6,-60,
+    180,6,240,180,-60,210,139,60,115,180,60,240,180,60,123,180,
+    120,0,180,0,240,60,0,210,139,60,0,180,60,240,180,0,
+    210,180,120,60,180,60,240,180,60,210,180,120,210,240,180,240,
+    180,120,210,180,60,60,180,120,240,120,60,210,180,120,0,180,
+    0,240,180,0,123,60,0,0,180,120,180,120,60,210,180,0,
+    0,120,60,240,60,0,210,120,60,77,180,60,240,142,60,85,
+    142,60,58,142,60,240,98,0,210,120,60,-60,120,60,240,120,
+    -60,210,180,120,60,180,60,240,120,60,210,180,120,210,240,180,
+    240,180,120,210,120,60,60,180,120,240,120,60,210,180,120,39,
+    104,0,240,79,-60,210,180,120,210,240,180,240,180,120,210,63,
+    -60,210,240,180,240,240,-60,210,142,60,115,180,60,240,180,60,
+    123,180,120,96,180,0,240,136,0,210,180,60,0,180,60,240,
+    180,0,210,180,120,60,180,60,240,180,60,210,180,120,210,240,
+    180,240,180,120,210,180,60,60,180,120,240,120,60,210,180,120,
+    77,142,60,240,120,0,210,180,120,210,240,180,240,180,120,210,
+    101,0,210,240,180,240,240,0,210,180,120,115,180,60,240,180,
+    60,210,180,120,210,240,180,240,180,120,210,139,60,210,240,180,
+    240,240,60,210,180,120,210,240,180,240,240,120,210,240,180,210,
+    240,180,240,180,120,210,240,180,60,180,120,240,120,60,210,180,
+    120,210,240,180,240,240,120,123,180,120,0,180,120,180,120,60,
+    210,240,180,0,120,60,240,60,0,210,180,120,77,180,60,240,
+    120,60,210,180,120,210,240,180,240,180,120,210,120,60,210,240,
+    180,240,240,60,101,120,60,-60,180,120,180,180,60,101,180,120,
+    -60,180,120,180,120,60,79,180,120,0,120,60,180,60,0,210,
+    180,120,210,240,180,240,240,120,85,120,60,-60,120,60,120,60,
+    0,210,240,180,-60,60,0,240,0,-60,210,139,60,115,180,60,
+    240,180,60,123,180,120,55,180,0,240,95,0,210,139,60,0,
+    120,60,240,120,0,210,180,120,60,180,60,240,120,60,210,180,
+    120,210,240,180,240,180,120,210,120,60,60,180,120,240,120,60,
+    210,180,120,36,120,0,240,76,0,210,180,120,210,240,180,240,
+    180,120,210,60,0,210,240,180,240,240,0,76,117,35,-120,117,
+    0,180,92,-3,76,60,0,-120,180,120,180,120,60,54,76,0,
+    -120,180,120,180,180,0,76,95,35,-120,180,120,180,180,60,76,
+    180,120,-120,180,120,180,120,60,54,180,120,0,120,60,180,60,
+    0,76,79,19,-60,180,120,180,180,60,60,120,60,-60,120,60,
+    120,60,0,38,180,120,-60,60,0,180,0,-60,210,180,120,60,
+    180,60,240,120,60,210,180,120,210,240,180,240,180,120,210,120,
+    60,210,240,180,240,240,60,60,79,0,-120,120,60,120,120,0,
+    60,120,60,-120,120,60,120,60,0,38,120,60,-60,60,0,120,
+    0,-60,210,180,120,210,240,180,240,240,120,44,60,0,-120,60,
+    0,60,0,-60,210,240,180,-120,0,-60,240,-60,-120,210,142,60,
+    30,142,0,240,120,0,123,136,0,96,180,0,240,136,0,210,
+    101,0,49,180,60,240,180,0,101,120,60,49,180,60,240,180,
+    60,101,180,120,49,180,-60,240,89,-60,210,180,60,-60,92,0,
+    240,67,-60,210,120,0,77,142,60,240,120,0,85,120,60,-60,
+    120,60,240,73,0,210,120,0,-60,120,0,240,120,-60,210,139,
+    60,115,180,60,240,180,60,123,180,120,0,180,0,240,60,0,
+    210,139,60,0,120,60,240,120,0,210,180,120,60,180,60,240,
+    120,60,210,180,120,210,240,180,240,180,120,210,120,60,60,180,
+    120,240,120,60,210,180,120,0,120,0,240,120,0,123,60,0,
+    0,180,120,180,120,60,210,120,0,0,120,60,240,60,0,210,
+    120,60,77,180,60,240,120,60,85,120,60,33,120,0,240,73,
+    -60,210,120,60,-60,76,0,240,60,-60,210,180,120,60,180,60,
+    240,120,60,210,180,120,210,240,180,240,180,120,210,120,60,60,
+    180,120,240,120,60,210,180,120,14,79,-60,240,54,-60,210,180,
+    120,210,240,180,240,180,120,210,38,-60,210,240,180,240,240,-60,
+    57,95,-6,-180,136,0,180,136,-6,57,136,0,-180,136,-60,180,
+    92,-60,51,95,0,-180,95,0,180,70,-60,73,92,32,-180,60,
+    0,180,60,-60,73,60,0,-180,180,120,180,120,60,51,60,0,
+    0,120,60,180,60,0,35,98,16,-60,98,-60,180,73,-60,73,
+    0,-60,-180,180,120,180,120,60,35,57,-60,-180,180,120,180,180,
+    -60,73,114,32,-180,114,0,180,89,-6,73,0,-60,-180,180,120,
+    180,120,60,51,73,0,-180,180,120,180,180,0,73,92,32,-180,
+    180,120,180,180,60,73,180,120,-180,180,120,180,120,60,51,180,
+    120,0,120,60,180,60,0,73,76,16,-60,180,120,180,180,60,
+    57,120,60,-60,120,60,120,60,0,35,180,120,-60,60,0,180,
+    0,-60,73,98,32,-120,98,0,180,73,-22,73,60,0,-120,180,
+    120,180,120,60,51,60,0,-120,180,120,180,180,0,57,76,0,
+    -120,120,60,120,120,0,57,120,60,-120,120,60,120,60,0,35,
+    120,60,-60,60,0,120,0,-60,73,60,0,-120,180,120,180,180,
+    60,41,60,0,-120,60,0,60,0,-60,19,180,120,-120,0,-60,
+    180,-60,-120,210,139,60,115,180,60,240,180,60,123,180,120,30,
+    180,0,240,70,0,210,139,60,0,120,60,240,60,0,210,180,
+    120,60,180,60,240,120,60,210,180,120,210,240,180,240,180,120,
+    210,120,60,60,180,120,240,120,60,210,180,120,11,120,0,240,
+    60,0,210,180,120,210,240,180,240,180,120,210,60,0,210,240,
+    180,240,240,0,51,92,0,-180,92,-60,120,67,-60,51,0,-60,
+    -180,120,60,120,60,0,29,51,-60,-180,120,60,120,120,-60,51,
+    70,0,-180,120,60,120,120,0,51,120,60,-180,120,60,120,60,
+    0,29,120,60,-60,60,0,120,0,-60,51,54,-6,-120,120,60,
+    120,120,0,35,60,0,-120,60,0,60,0,-60,13,120,60,-120,
+    0,-60,120,-60,-120,210,180,120,60,180,60,240,120,60,210,180,
+    120,210,240,180,240,180,120,210,120,60,210,240,180,240,240,60,
+    35,54,-60,-180,60,0,60,60,-60,35,60,0,-180,60,0,60,
+    0,-60,13,60,0,-120,0,-60,60,-60,-120,210,180,120,210,240,
+    180,240,240,120,19,0,-60,-180,0,-60,24,-60,-120,210,240,180,
+    -180,-60,-120,240,-120,-180,-210,0,-120,-240,60,-101,60,60,-120,-210,
+    60,-60,-240,60,-139,60,-6,-139,-85,60,-95,-240,60,-95,-36,60,
+    -142,-210,35,-120,-240,60,-120,-17,60,-120,-210,60,-120,-240,120,-120,
+    120,32,-120,-51,60,-120,-120,35,-60,120,0,-120,-60,60,-79,-240,
+    60,-92,120,60,-117,-210,60,-92,-240,120,-51,120,32,-76,-60,60,
+    -114,-240,120,-73,120,120,-139,-210,60,-120,-240,60,-120,60,60,-180,
+    -210,60,-120,-240,120,-60,120,32,-60,-44,0,-98,-240,120,-57,120,
+    120,-101,-210,35,-180,-240,120,-38,120,120,-63,-210,120,-22,-240,120,
+    -180,120,32,-180,-73,120,-180,-240,35,-60,120,0,-180,-73,32,-180,
+    -240,120,-120,120,120,-180,-210,60,-54,-240,60,-54,60,0,-79,-73,
+    120,-180,-240,0,-76,120,-60,-180,-76,3,-79,-240,3,-120,-33,0,
+    -120,-210,0,-79,-240,120,-54,120,16,-79,-44,0,-92,-240,120,-54,
+    120,120,-120,-210,0,-180,-240,120,-38,120,120,-63,-210,120,-22,-240,
+    120,-54,120,16,-79,-44,120,-54,-120,19,-76,120,-6,-120,-76,-35,
+    -95,-240,120,-70,120,120,-95,-210,120,-22,-240,120,-70,120,0,-95,
+    -76,120,-92,-240,120,-92,-52,120,-180,-210,0,-60,-240,0,-101,-14,
+    0,-120,-210,0,-60,-240,120,-60,120,0,-60,-44,0,-95,-240,120,
+    -57,120,120,-101,-210,0,-120,-240,120,-38,120,120,-63,-210,120,-22,
+    -240,120,-120,120,-60,-120,-51,120,-120,-120,0,-60,120,-60,-120,-60,
+    0,-79,-240,60,-51,60,60,-76,-210,120,-22,-240,120,-51,60,0,
+    -76,-60,0,-73,-240,120,-73,-33,120,-139,-210,-60,-120,-240,120,-38,
+    120,120,-60,-210,120,-22,-240,120,-60,120,0,-60,-44,60,-57,-240,
+    120,-57,-17,120,-101,-210,120,-22,-240,120,-38,2,120,-63,-210,120,
+    -22,-240,180,120,180,120,60,-19,120,0,-24,120,60,180,60,0,
+    -35,120,-22,-60,120,-60,180,120,-60,-13,0,-60,-60,120,60,120,
+    60,0,-35,120,-60,-60,60,0,180,0,-60,-51,0,-92,-120,120,
+    -38,180,60,-63,-29,120,-22,-120,120,-120,180,-60,-120,-51,60,0,
+    -120,120,-60,180,120,-120,-51,6,-54,-120,0,-60,120,0,-120,-13,
+    0,-60,-120,120,60,120,60,0,-35,0,-60,-60,60,0,120,0,
+    -60,-51,120,-22,-120,120,-120,180,120,-120,-29,-60,-120,-120,60,0,
+    60,0,-60,-51,120,-120,-120,0,-60,180,-60,-120,-57,6,-95,-180,
+    6,-120,180,0,-136,-51,0,-95,-180,60,-70,180,0,-95,-57,0,
+    -136,-180,60,0,180,60,-136,-35,0,-98,-180,60,-73,60,60,-98,
+    -35,60,-57,-180,60,0,180,0,-60,-73,60,0,-120,0,-60,180,
+    -60,-120,-73,-32,-92,-180,60,0,180,60,-60,-51,60,0,-180,60,
+    0,60,0,-60,-73,60,0,-180,60,0,180,60,-180,-210,-60,-120,
+    -240,60,-120,60,60,-180,-210,60,-120,-240,60,0,60,0,-60,-85,
+    60,0,-240,60,0,60,60,-120,-210,60,-180,-240,60,0,60,60,
+    -60,-210,60,0,-240,180,120,180,120,60,-19,60,0,-24,120,60,
+    180,60,0,-35,60,-54,-60,60,0,180,60,-60,-13,0,-60,-60,
+    120,60,120,60,0,-35,60,0,-60,60,0,180,0,-60,-73,-32,
+    -114,-180,6,-89,180,0,-114,-51,0,-73,-180,0,-60,180,-60,-120,
+    -73,60,0,-180,0,-60,180,0,-180,-210,0,-180,-240,0,-60,0,
+    0,-120,-210,0,-60,-240,180,120,180,120,60,-19,60,0,-24,120,
+    60,180,60,0,-73,-32,-92,-180,-60,-120,180,-60,-180,-210,-60,-120,
+    -240,180,120,180,120,60,-73,-120,-180,-240,180,120,180,180,-180,-210,
+    0,-101,-240,0,-120,-30,0,-142,-210,0,-101,-240,60,-60,60,0,
+    -76,-85,0,-120,-240,60,-70,60,60,-120,-210,0,-120,-240,60,-54,
+    60,60,-79,-210,60,-38,-240,60,-120,60,0,-120,-85,60,-120,-240,
+    0,-73,60,-60,-120,-101,-60,-120,-240,60,-67,60,60,-92,-210,60,
+    -38,-240,60,-67,60,0,-92,-101,60,-89,-240,60,-89,-49,60,-180,
+    -210,-60,-120,-240,60,-54,60,60,-76,-210,60,-38,-240,60,-60,60,
+    0,-76,-85,60,-73,-240,60,-73,-33,60,-120,-210,60,-38,-240,60,
+    -54,-14,60,-79,-210,60,-38,-240,180,120,180,120,60,-19,60,0,
+    -24,120,60,180,60,0,-35,60,-38,-60,60,-60,180,60,-60,-13,
+    0,-60,-60,120,60,120,60,0,-35,60,-60,-60,60,0,180,0,
+    -60,-51,0,-92,-120,60,-67,180,60,-92,-29,60,-51,-120,60,-60,
+    180,-60,-120,-51,60,0,-120,0,-60,180,0,-120,-210,0,-120,-240,
+    0,-60,0,0,-120,-210,0,-60,-240,180,120,180,120,60,-19,60,
+    0,-24,120,60,180,60,0,-51,0,-70,-120,0,-120,180,-60,-120,
+    -210,-60,-120,-240,180,120,180,120,60,-51,-60,-120,-240,180,120,180,
+    180,-120,-210,-60,-139,-240,0,-60,0,0,-120,-210,0,-60,-240,0,
+    -60,0,-60,-120,-123,0,-70,-240,0,-70,-30,0,-180,-210,0,-60,
+    -240,0,-60,-11,0,-120,-210,0,-60,-240,180,120,180,120,60,-19,
+    60,0,-24,120,60,180,60,0,-35,60,-54,-60,60,-60,180,0,
+    -60,-210,-60,-120,-240,180,120,180,120,60,-35,0,-60,-240,180,120,
+    180,180,-60,-210,-60,-120,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,
+    180,120,180,120,60,-19,60,0,-240,180,120,180,180,0,-210,-120,
+    -180,-240,180,120,180,180,60,-210,180,120,-240,180,120,180,120,60,
+    -19,180,120,-24,120,60,180,60,0,-35,60,-54,-60,180,120,180,
+    180,60,-13,120,60,-60,120,60,120,60,0,-35,180,120,-60,60,
+    0,180,0,-60,-29,60,-51,-120,60,-67,180,60,-92,-29,60,-51,
+    -120,180,120,180,120,60,-19,60,0,-120,180,120,180,180,0,-13,
+    6,-54,-120,120,60,120,120,0,-13,120,60,-120,120,60,120,60,
+    0,-35,120,60,-60,60,0,120,0,-60,-51,0,-70,-120,180,120,
+    180,180,60,-29,60,0,-120,60,0,60,0,-60,-51,180,120,-120,
+    0,-60,180,-60,-120,-35,6,-95,-180,60,-70,180,60,-95,-35,60,
+    -57,-180,60,-70,180,0,-95,-57,60,0,-180,60,-92,180,60,-136,
+    -35,60,-57,-180,60,-73,180,60,-98,-35,60,-57,-180,180,120,180,
+    120,60,-19,60,0,-24,120,60,180,60,0,-35,60,-54,-60,60,
+    -60,180,0,-60,-51,0,-60,-180,180,120,180,120,60,-35,0,-60,
+    -180,180,120,180,180,-60,-51,22,-60,-180,22,-73,120,0,-98,-19,
+    0,-60,-180,120,60,120,60,0,-41,0,-60,-180,120,60,120,120,
+    -60,-19,0,-60,-180,120,60,120,120,0,-19,120,60,-180,120,60,
+    120,60,0,-41,120,60,-60,60,0,120,0,-60,-19,0,-76,-120,
+    120,60,120,120,0,-35,60,0,-120,60,0,60,0,-60,-57,120,
+    60,-120,0,-60,120,-60,-120,-51,6,-73,-180,6,-89,180,0,-114,
+    -51,0,-73,-180,180,120,180,120,60,-19,60,0,-180,180,120,180,
+    180,0,-35,-16,-76,-180,60,0,60,60,-60,-35,60,0,-180,60,
+    0,60,0,-60,-57,60,0,-120,0,-60,60,-60,-120,-73,-32,-92,
+    -180,180,120,180,180,60,-51,0,-60,-180,0,-60,0,-60,-120,-73,
+    180,120,-180,-60,-120,180,-120,-180,-210,0,-120,-240,0,-142,-55,0,
+    -142,-210,0,-120,-240,60,-120,60,-6,-120,-85,0,-136,-240,60,-95,
+    60,60,-142,-210,-3,-180,-240,60,-76,60,60,-104,-210,60,-60,-240,
+    60,-180,60,-6,-180,-85,60,-180,-240,-3,-98,60,-60,-180,-101,-60,
+    -120,-240,60,-92,60,60,-117,-210,60,-63,-240,60,-92,60,-22,-117,
+    -101,60,-114,-240,60,-114,-74,60,-180,-210,-60,-120,-240,60,-79,60,
+    60,-104,-210,60,-63,-240,60,-120,60,-60,-120,-85,0,-98,-240,60,
+    -98,-58,60,-142,-210,60,-63,-240,60,-79,-39,60,-104,-210,60,-63,
+    -240,120,60,120,60,0,-44,60,-60,-60,60,0,120,0,-60,-60,
+    60,-63,-120,60,-120,120,60,-120,-38,-60,-120,-120,60,0,60,0,
+    -60,-60,60,-120,-120,0,-60,120,-60,-120,-76,-35,-117,-180,3,-92,
+    120,0,-117,-54,0,-76,-180,0,-60,120,-60,-120,-76,0,-60,-180,
+    0,-60,120,0,-180,-210,0,-180,-240,0,-60,0,0,-120,-210,0,
+    -60,-240,120,60,120,60,0,-44,0,-60,-60,60,0,120,0,-60,
+    -76,-35,-95,-180,-60,-120,120,-60,-180,-210,-60,-120,-240,120,60,120,
+    60,0,-76,-120,-180,-240,120,60,120,120,-180,-210,-60,-139,-240,0,
+    -76,0,0,-120,-210,0,-60,-240,0,-120,0,-60,-120,-123,0,-95,
+    -240,0,-95,-55,0,-180,-210,0,-60,-240,0,-76,-36,0,-120,-210,
+    0,-60,-240,120,60,120,60,0,-44,0,-60,-60,60,0,120,0,
+    -60,-60,0,-79,-120,0,-120,120,-60,-120,-210,-60,-120,-240,120,60,
+    120,60,0,-60,-60,-120,-240,120,60,120,120,-120,-210,-60,-120,-240,
+    -60,-120,-60,-60,-180,-210,-60,-120,-240,120,60,120,60,0,-44,0,
+    -60,-240,120,60,120,120,-60,-210,-120,-180,-240,120,60,120,120,0,
+    -210,120,60,-240,120,60,120,60,0,-44,120,60,-60,60,0,120,
+    0,-60,-60,0,-79,-120,120,60,120,120,0,-38,60,0,-120,60,
+    0,60,0,-60,-60,120,60,-120,0,-60,120,-60,-120,-54,3,-76,
+    -180,3,-92,120,0,-117,-54,0,-76,-180,120,60,120,60,0,-44,
+    0,-60,-180,120,60,120,120,-60,-38,-19,-79,-180,60,0,60,60,
+    -60,-38,60,0,-180,60,0,60,0,-60,-60,60,0,-120,0,-60,
+    60,-60,-120,-76,-35,-95,-180,120,60,120,120,0,-54,0,-60,-180,
+    0,-60,0,-60,-120,-76,120,60,-180,-60,-120,120,-120,-180,-210,-60,
+    -142,-240,0,-120,0,0,-142,-210,0,-101,-240,0,-180,0,-60,-180,
+    -123,0,-136,-240,0,-136,-96,0,-180,-210,0,-101,-240,0,-120,-77,
+    0,-142,-210,0,-101,-240,60,0,60,0,-60,-85,0,-120,-120,0,
+    -60,60,-60,-120,-101,-60,-120,-180,-60,-120,60,-60,-180,-210,-60,-120,
+    -240,60,0,60,0,-60,-101,-120,-180,-240,60,0,60,60,-180,-210,
+    -60,-120,-240,-60,-120,-77,-60,-180,-210,-60,-120,-240,60,0,60,0,
+    -60,-85,-60,-120,-240,60,0,60,60,-120,-210,-120,-180,-240,60,0,
+    60,60,-60,-210,60,0,-240,60,0,60,0,-60,-85,60,0,-120,
+    0,-60,60,-60,-120,-101,-60,-120,-180,60,0,60,60,-60,-79,0,
+    -60,-180,0,-60,0,-60,-120,-101,60,0,-180,-60,-120,60,-120,-180,
+    -210,-60,-139,-240,-60,-180,-115,-60,-180,-210,-60,-139,-240,0,-60,0,
+    -60,-120,-123,-120,-180,-240,0,-60,0,0,-180,-210,-120,-180,-240,0,
+    -60,0,0,-120,-210,0,-60,-240,0,-60,0,-60,-120,-123,0,-60,
+    -180,-60,-120,0,-120,-180,-210,-120,-180,-240,-60,-120,-60,-60,-180,-210,
+    -60,-120,-240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,
+    -240
+},
+{
+    -8,210,-210,-85,210,-210,-9,210,-210,-2,57,-210,-7,210,-210,-3,
+    35,-210,-22,210,-210,-210,210,-57,-17,210,-210,8,76,-210,-210,76,
+    -210,2,51,-210,8,73,-210,3,210,-210,-27,51,-210,-32,51,-210,
+    -210,54,-73,-27,29,-210,-27,210,-76,-123,210,-210,-3,210,-210,-8,
+    210,-210,-210,210,-51,210,51,-76,-32,210,-210,-210,210,-73,-27,210,
+    -210,8,60,-210,9,101,-210,2,101,-210,8,73,-210,-210,101,-210,
+    101,35,-210,2,60,-210,-210,60,-35,7,35,-210,27,76,-210,-210,
+    76,-210,26,51,-210,32,73,-210,27,210,-210,-33,73,-210,-38,51,
+    -210,-210,76,-73,-33,51,-210,-32,73,-210,-210,60,-210,16,35,-210,
+    22,35,-210,-210,101,-51,101,19,-76,-38,35,-210,-210,60,-73,-33,
+    35,-210,-27,210,-101,-101,210,-101,-14,210,-101,-8,35,-60,-60,210,
+    -210,-27,35,-210,-32,210,-101,-101,210,-73,-27,210,-210,-32,210,-73,
+    -16,210,-210,-27,210,-210,-27,210,-210,-210,210,-35,210,35,-60,-22,
+    51,-101,-101,38,-57,210,13,-101,-32,210,-76,-60,210,-210,-27,210,
+    -210,-27,210,-210,-210,210,-51,210,19,-76,-38,210,-210,-210,210,-73,
+    -33,210,-210,-2,85,-210,-210,85,-210,85,85,-210,22,57,-210,17,
+    123,-210,-3,57,-210,-8,44,-210,-210,123,-51,-3,123,-210,8,44,
+    -210,-210,76,-210,123,51,-210,22,73,-210,-210,123,-210,123,19,-210,
+    8,51,-210,-210,44,-51,123,19,-210,-8,44,-210,-2,85,-210,-3,
+    85,-210,-3,85,-210,-210,85,-29,85,41,-54,-8,44,-210,-210,44,
+    -51,-3,19,-210,8,60,-210,14,101,-210,13,101,-210,22,73,-210,
+    -210,101,-210,101,35,-210,8,60,-210,-210,60,-35,13,35,-210,32,
+    76,-210,-210,76,-210,32,51,-210,38,73,-210,33,210,-210,-28,73,
+    -210,-33,51,-210,-210,76,-19,-28,51,-210,-27,73,-210,-210,60,-210,
+    16,35,-210,22,35,-210,-210,101,-13,101,57,-38,-33,35,-210,-210,
+    60,-35,-28,35,-210,-8,51,-210,-2,85,-210,-9,85,-210,-3,73,
+    -210,-210,85,-210,85,19,-210,-8,51,-210,-210,44,-51,-3,19,-210,
+    22,44,-210,-210,44,-210,123,19,-210,22,19,-210,-210,123,-13,123,
+    57,-38,0,35,-79,-79,60,-35,123,35,-79,-27,73,-210,-210,44,
+    -210,0,19,-210,6,19,-210,-210,85,-29,85,41,-54,-33,19,-210,
+    -210,44,-51,-28,19,-210,-22,210,-85,-123,210,-123,-17,210,-123,-8,
+    51,-123,-123,210,-123,210,35,-123,-22,210,-123,-123,210,-57,-17,210,
+    -123,2,210,-85,-85,54,-85,2,29,-85,8,51,-44,3,210,-210,
+    -33,51,-210,-38,29,-85,-85,54,-73,-33,29,-210,-32,210,-76,-123,
+    210,-123,210,210,-123,-8,210,-123,-123,210,-51,210,19,-76,-38,210,
+    -123,-123,210,-73,-33,210,-210,-32,210,-85,-85,210,-85,2,210,-85,
+    8,51,-51,3,210,-210,-33,51,-210,-38,210,-85,-85,210,-73,-33,
+    210,-210,-38,210,-73,0,210,-210,-33,210,-210,-33,210,-210,-210,210,
+    -19,210,51,-44,-6,29,-85,-85,54,-41,210,29,-85,-22,210,-44,
+    -123,38,-123,210,13,-123,0,13,-123,-123,79,-35,79,35,-60,-22,
+    13,-123,-123,38,-57,210,13,-123,-32,210,-101,-101,210,-101,-14,210,
+    -101,-8,35,-60,-13,210,-210,-33,35,-210,-38,210,-101,-101,210,-73,
+    -33,210,-210,-38,210,-73,-16,210,-210,-33,210,-210,-33,210,-210,-210,
+    210,-35,210,35,-60,-22,13,-101,-101,38,-57,210,13,-101,-38,210,
+    -76,-32,210,-210,-33,210,-210,-33,210,-210,-210,210,-51,210,19,-76,
+    -38,210,-210,-210,210,-73,-33,210,-210,-85,-60,-240,-10,55,-240,-60,
+    30,-240,-210,-180,-240,-240,0,-240,30,-180,-240,-123,14,-240,-240,0,
+    -180,0,0,-240,9,33,-240,-240,-120,-240,27,-180,-240,14,-180,-240,
+    9,115,-240,-27,-180,-240,-85,-180,-240,-240,-120,-180,-27,-180,-240,-101,
+    -60,-240,-240,-60,-240,-60,-60,-240,-2,-60,-240,-240,77,-120,-60,-120,
+    -180,-101,-120,-240,-240,60,-180,-30,60,-240,-210,-120,-240,-240,-60,-240,
+    60,-60,-240,-210,-180,-240,-240,-60,-240,60,-180,-240,-85,-60,-240,-240,
+    -120,-180,60,-180,-240,-210,-120,-240,-240,-120,-240,60,-180,-240,-210,-180,
+    -240,-240,60,-240,60,-180,-240,0,-180,-240,-240,-120,-180,60,-180,-240,
+    -16,-120,-240,-240,-120,-240,-60,-180,-240,-210,-180,-240,-240,-60,-120,-60,
+    -120,-180,-16,-180,-240,-240,-120,-180,60,-180,-240,-123,17,-240,-240,-60,
+    -240,-60,-60,-240,-2,-60,-240,-7,77,-240,-27,-180,-240,-123,-120,-180,
+    -180,36,-180,-30,11,-240,-210,-120,-240,-240,0,-240,-27,0,-240,-210,
+    0,-240,-240,0,-60,0,-60,-120,-123,-120,-180,-180,-60,-120,0,-120,
+    -180,-60,-120,-240,-26,39,-240,-60,14,-240,-210,-60,-240,-240,-60,-120,
+    -60,-120,-180,-32,-2,-240,-240,-120,-180,-27,-180,-240,-7,36,-240,-240,
+    -60,-240,-60,-60,-240,17,-180,-240,12,96,-240,-8,-180,-240,-123,-120,
+    -240,-240,55,-180,-8,30,-240,-210,-120,-240,-240,-120,-240,0,-180,-240,
+    -210,-180,-240,-240,0,-240,30,-180,-240,3,-180,-240,-240,-120,-180,8,
+    -180,-240,-60,-120,-240,-7,58,-240,-60,33,-240,-210,-60,-240,-240,-60,
+    -120,-60,-120,-180,-13,17,-240,-240,-120,-180,-8,-180,-240,3,-120,-240,
+    9,74,-240,-60,49,-240,-210,-180,-240,-240,-60,-240,30,-180,-240,3,
+    33,-240,-240,-120,-180,8,-180,-240,27,52,-240,-240,-120,-240,27,-180,
+    -240,33,-180,-240,28,210,-240,-210,-180,-240,-210,-180,-240,-240,-120,-180,
+    -210,-180,-240,-210,-120,-240,-240,-120,-240,-60,-180,-240,-210,-180,-240,-240,
+    -60,-120,-60,-120,-180,-210,-180,-240,-240,-120,-180,-210,-180,-240,-210,-120,
+    -240,-240,-60,-240,-115,-60,-240,-210,-180,-240,-240,-60,-240,0,-180,-240,
+    -123,-120,-240,-240,-120,-180,-8,-180,-240,-210,-120,-240,-240,-120,-240,0,
+    -180,-240,-210,-180,-240,-240,0,-60,0,-60,-120,-123,-120,-180,-180,-60,
+    -120,0,-120,-180,-210,-120,-240,-240,-120,-240,-60,-180,-240,-210,-180,-240,
+    -240,-60,-120,-60,-120,-180,-210,-180,-240,-240,-120,-180,-210,-180,-240,-210,
+    -60,-240,-240,-60,-240,-60,-60,-240,-210,-180,-240,-240,0,-240,-30,-180,
+    -240,-123,-120,-240,-240,0,-180,-96,0,-240,-210,-120,-240,-240,-120,-240,
+    -77,-180,-240,-210,-180,-240,-240,0,-240,8,-180,-240,-85,-180,-240,-240,
+    -120,-180,0,-180,-240,-101,-120,-240,-180,-60,-240,-60,-60,-240,-210,-60,
+    -240,-240,-60,-120,-60,-120,-180,-101,-120,-240,-240,-120,-180,-30,-180,-240,
+    -210,-120,-240,-240,-60,-240,-77,-60,-240,-210,-60,-120,-240,-60,-240,60,
+    -180,-240,-85,-60,-240,-240,-120,-180,60,-180,-240,-210,-120,-240,-240,-120,
+    -240,60,-180,-240,-210,-180,-240,-240,60,-24,60,0,-60,-85,-60,-120,
+    -120,0,-60,60,-60,-120,-101,-60,-120,-180,-60,-180,60,-120,-180,-79,
+    -120,-180,-180,0,-60,0,-60,-120,-101,-120,-180,-180,-60,-120,60,-120,
+    -180,-210,-120,-240,-240,-60,-240,-115,-60,-240,-210,-180,-240,-240,-60,-240,
+    -8,-180,-240,-123,-120,-240,-240,-120,-180,-30,-180,-240,-210,-120,-240,-240,
+    -120,-240,0,-180,-240,-210,-180,-240,-240,0,-60,0,-60,-120,-123,-120,
+    -180,-180,-60,-120,0,-120,-180,-210,-120,-240,-240,-120,-240,-60,-180,-240,
+    -210,-180,-240,-240,-60,-120,-60,-120,-180,-210,-180,-240,-240,-120,-180,-210,
+    -180,-240,-9,240,-55,-60,240,-30,10,240,-55,85,180,-14,-60,240,
+    -115,-9,180,-115,-17,240,0,-60,240,180,-12,240,-115,2,240,60,
+    60,180,-77,7,120,-77,13,180,-60,-60,240,-60,240,180,-60,2,
+    120,-77,-77,180,120,240,120,-77,-14,240,-33,-60,240,-115,-9,240,
+    -115,-9,240,-115,-115,240,180,240,180,120,-14,240,-115,-115,240,180,
+    -9,240,-115,2,240,-17,27,240,-77,7,240,-77,123,180,-36,0,
+    180,-11,180,60,-36,2,240,-77,-77,120,60,7,60,-77,26,240,
+    -39,60,180,-14,26,120,-39,32,180,2,27,240,-210,-28,180,-210,
+    -33,120,60,60,180,120,-28,120,-210,-27,240,-52,-27,120,0,240,
+    60,0,123,60,0,0,180,120,180,120,60,-33,60,0,0,120,
+    60,-28,60,-210,-3,240,60,-60,240,-49,-9,240,-74,-3,180,-33,
+    -60,240,-60,240,180,-60,210,240,60,-60,240,180,240,240,-60,16,
+    240,120,-60,240,-60,240,240,-60,16,240,-60,-60,240,180,240,180,
+    120,210,120,60,60,180,120,240,120,60,-27,240,-52,-60,240,-60,
+    240,240,-60,0,240,-60,-60,240,180,240,180,120,-33,240,-60,-60,
+    240,180,-28,240,-210,-3,240,60,30,240,-49,-9,240,-74,-3,180,
+    -33,-8,240,0,240,180,0,210,240,0,-30,240,180,240,240,0,
+    101,240,60,60,180,60,180,120,60,101,180,120,30,240,-210,-28,
+    180,-210,-33,120,60,60,180,120,-28,120,-210,-27,240,-52,-27,240,
+    0,240,240,0,85,240,0,0,240,180,240,180,120,-33,240,0,
+    -8,240,180,-28,240,-210,-27,240,-52,-27,240,60,240,240,60,123,
+    180,120,30,240,-210,-28,180,-210,-33,240,60,8,240,180,-28,240,
+    -210,-33,240,120,60,240,-210,-28,240,-210,-28,240,-210,-210,240,180,
+    240,180,120,210,120,60,60,180,120,240,120,60,210,240,120,0,
+    120,0,240,60,0,123,60,0,0,180,120,180,120,60,210,60,
+    0,0,120,60,240,60,0,210,120,60,-60,240,60,240,240,60,
+    85,120,60,-60,120,-60,240,24,-60,210,120,60,-60,60,0,240,
+    24,-60,101,120,60,-60,60,-60,180,24,-60,101,24,-60,-60,180,
+    120,180,120,60,79,60,0,0,120,60,180,60,0,210,240,120,
+    -60,60,-60,240,24,-60,85,24,-60,-60,120,60,120,60,0,210,
+    24,-60,-60,60,0,240,24,-60,-17,240,-36,0,240,-96,-12,240,
+    -96,-3,180,-55,-8,240,-30,240,180,-55,-17,240,-96,-96,240,180,
+    -12,240,-96,7,240,-58,60,180,-33,7,120,-58,13,180,-17,8,
+    240,-210,-28,180,-210,-33,120,60,60,180,120,-28,120,-210,-27,240,
+    -52,-30,240,0,240,240,0,-3,240,0,-8,240,180,240,180,120,
+    -33,240,0,-30,240,180,-28,240,-210,-27,240,-52,-27,240,60,240,
+    240,60,123,180,120,8,240,-210,-28,180,-210,-33,240,60,0,240,
+    180,-28,240,-210,-33,240,120,60,240,-210,-28,240,-210,-28,240,-210,
+    -210,240,180,240,180,120,210,120,60,60,180,120,240,120,60,210,
+    240,120,0,120,0,240,60,0,123,60,0,0,180,120,180,120,
+    60,210,60,0,0,120,60,240,60,0,-27,240,-74,-30,240,-49,
+    -9,240,-74,-3,180,-33,-8,240,-210,-28,180,-210,-33,240,60,-30,
+    240,180,-28,240,-210,-33,240,120,60,240,-210,-28,240,-210,-28,240,
+    -210,-210,240,180,240,180,120,210,120,60,60,180,120,240,120,60,
+    -33,240,-52,-27,240,-210,-28,240,-210,-28,240,-210,-210,240,180,240,
+    180,120,-33,240,-210,-210,240,180,-28,240,-210,210,120,0,-60,120,
+    -60,240,101,-60,85,95,-60,36,142,-60,240,95,-60,210,60,-60,
+    -60,139,6,240,139,-60,60,79,-60,-120,117,-60,240,92,-60,60,
+    114,-60,-120,139,-120,240,73,-120,210,92,-60,-120,76,-32,240,51,
+    -120,210,120,-35,17,120,-60,240,120,-60,51,120,-60,-120,120,0,
+    120,60,-35,210,120,-60,-120,120,-32,240,120,-120,76,79,-3,33,
+    120,0,240,120,-3,44,92,0,-120,120,-120,240,54,-120,210,79,
+    0,-120,79,-16,240,54,-120,76,95,35,-120,95,-120,240,70,-120,
+    76,92,-120,52,180,-120,240,92,-120,210,22,-120,-120,95,0,240,
+    70,-120,210,180,0,-120,63,-120,240,38,-120,44,54,-120,-120,120,
+    6,120,76,-19,210,22,-120,-120,79,-16,240,54,-120,210,120,-60,
+    -60,180,-60,240,120,-60,44,98,0,-120,101,-120,240,57,-120,210,
+    120,-60,-120,60,-32,240,60,-120,73,180,-32,-120,180,-120,240,120,
+    -120,73,180,-120,-120,180,60,240,76,0,210,54,-60,-60,79,0,
+    240,54,-60,210,180,-35,-120,63,-120,240,38,-120,73,180,-120,-120,
+    180,0,240,60,-35,210,22,-120,-120,180,-32,240,180,-120,57,95,
+    -6,-180,136,0,180,120,-6,57,136,0,-180,136,-60,180,0,-60,
+    51,95,0,-180,95,0,180,70,-60,73,92,32,-180,60,-60,180,
+    0,-60,73,0,-60,-180,180,-60,180,0,-60,51,0,-60,-60,60,
+    0,180,0,-60,35,98,0,-60,98,-60,180,73,-60,73,0,-60,
+    -180,120,60,120,60,0,35,57,-60,-180,60,0,180,0,-60,73,
+    114,32,-180,114,0,180,89,-6,73,0,-60,-180,180,0,180,60,
+    0,51,73,0,-180,120,60,180,60,0,73,92,32,-180,180,60,
+    180,120,60,73,180,120,-180,180,-180,240,-120,-180,210,120,60,-180,
+    -60,-120,240,-120,-180,210,180,0,0,120,0,240,60,0,19,0,
+    -60,-180,0,-60,24,-60,-120,210,60,0,-180,-60,-120,240,-120,-180,
+    210,120,60,-60,180,-60,240,120,-60,85,0,-60,-60,120,-60,240,
+    0,-60,210,120,-60,-60,60,0,240,0,-60,35,54,-60,-180,60,
+    -60,60,0,-60,35,0,-60,-180,60,0,60,0,-60,13,60,0,
+    -120,0,-60,60,-60,-120,210,180,-60,-60,60,-60,240,0,-60,19,
+    0,-60,-180,0,-60,24,-60,-120,210,0,-60,-180,-60,-120,240,-120,
+    -180,210,60,0,14,120,0,240,101,0,44,95,0,-120,101,-120,
+    240,57,-120,210,60,0,-120,60,0,240,60,-120,60,79,0,-60,
+    76,-60,240,51,-60,60,73,0,33,139,-120,240,73,-120,210,22,
+    -120,-60,76,0,240,51,-120,210,120,0,-120,63,-120,240,38,-120,
+    51,120,-120,-120,120,60,120,60,0,210,22,-120,-120,120,60,240,
+    120,-120,51,92,0,-180,63,-60,120,38,-120,51,0,-60,-180,120,
+    -120,120,60,-120,29,22,-120,-180,120,60,120,120,-120,51,22,-120,
+    -180,120,-120,120,120,-120,51,120,-120,-180,120,60,120,60,0,29,
+    120,60,-60,60,0,120,0,-60,51,54,-6,-120,120,0,120,60,
+    0,35,60,0,-120,60,0,60,0,-60,13,60,0,-120,0,-60,
+    120,-60,-120,210,120,60,-120,60,-120,240,38,-120,44,57,-60,17,
+    101,-120,240,57,-120,210,22,-120,-120,60,0,240,60,-120,35,22,
+    -120,-180,60,-120,60,60,-120,35,60,-120,-180,60,0,60,0,-60,
+    13,60,0,-120,0,-60,60,-60,-120,210,22,-120,-2,63,-120,240,
+    38,-120,19,0,-120,-180,0,-60,24,-60,-120,210,22,-120,-180,-60,
+    -120,240,-120,-180,210,120,0,55,142,0,240,142,0,85,136,0,
+    -60,142,-60,240,95,-60,210,120,0,-60,120,6,240,120,-60,101,
+    120,60,-60,117,-60,240,92,-60,101,114,-60,74,180,-60,240,114,
+    -60,210,63,-60,-60,117,22,240,92,-60,210,180,3,-60,104,-60,
+    240,76,-60,85,180,-60,-60,180,60,240,98,3,210,60,-60,-60,
+    180,6,240,180,-60,76,117,35,-120,117,0,180,92,-3,76,60,
+    0,-120,180,0,180,60,0,54,76,0,-120,120,60,180,60,0,
+    76,95,35,-120,180,60,180,120,60,76,180,120,-120,180,-120,240,
+    -60,-120,210,120,60,-120,0,-60,240,-60,-120,210,180,0,0,120,
+    0,240,60,0,44,60,0,-120,60,0,60,0,-60,210,60,0,
+    -120,0,-60,240,-60,-120,210,120,60,-60,104,-60,240,79,-60,85,
+    98,0,58,142,-60,240,98,-60,210,63,-60,-60,120,60,240,120,
+    -60,60,63,-60,-120,120,-60,120,120,-60,60,120,-60,-120,120,60,
+    120,60,0,38,120,60,-60,60,0,120,0,-60,210,63,-60,39,
+    104,-60,240,79,-60,44,60,-60,-120,60,0,60,0,-60,210,63,
+    -60,-120,0,-60,240,-60,-120,210,142,60,0,142,0,240,120,0,
+    123,136,0,96,180,0,240,136,0,210,101,0,0,180,60,240,
+    180,0,101,120,60,-60,180,60,180,120,60,101,180,120,-60,180,
+    -60,240,0,-60,210,120,60,-60,60,0,240,0,-60,210,101,0,
+    77,142,0,240,120,0,85,120,0,-60,120,60,120,60,0,210,
+    101,0,-60,60,0,240,0,-60,210,139,60,115,180,60,240,180,
+    60,123,180,120,0,180,0,240,60,0,210,139,60,0,120,60,
+    240,60,0,210,180,120,60,180,60,240,120,60,210,180,120,210,
+    240,180,240,180,120,210,120,60,60,180,120,240,120,60,210,180,
+    120,0,120,0,240,60,0,123,60,0,0,180,120,180,120,60,
+    210,60,0,0,120,60,240,60,0,210,120,60,77,180,60,240,
+    120,60,85,120,60,-60,120,-60,240,0,-60,210,120,60,-60,60,
+    0,240,0,-60,101,120,60,-60,60,-60,180,0,-60,101,0,-60,
+    -60,180,120,180,120,60,79,60,0,0,120,60,180,60,0,210,
+    180,120,-60,60,-60,240,0,-60,85,0,-60,-60,120,60,120,60,
+    0,210,0,-60,-60,60,0,240,0,-60,210,139,60,0,120,0,
+    240,76,0,123,95,0,55,180,0,240,95,0,210,60,0,0,
+    120,60,240,120,0,60,79,0,-120,120,60,120,120,0,60,120,
+    60,-120,120,-120,240,-60,-120,210,120,60,-120,0,-60,240,-60,-120,
+    210,60,0,36,120,0,240,76,0,44,60,0,-120,60,0,60,
+    0,-60,210,60,0,-120,0,-60,240,-60,-120,54,76,-3,-120,117,
+    0,180,92,-3,44,60,0,-120,60,-120,180,-60,-120,54,76,0,
+    -120,0,-60,180,-60,-120,76,95,35,-120,0,-120,180,-60,-120,76,
+    -60,-120,-120,180,120,180,120,60,54,60,0,0,120,60,180,60,
+    0,38,79,19,-60,60,-60,180,0,-60,60,0,-60,-60,120,60,
+    120,60,0,38,0,-60,-60,60,0,180,0,-60,210,120,60,60,
+    180,60,240,120,60,44,60,0,-120,60,-120,240,-60,-120,210,120,
+    60,-120,0,-60,240,-60,-120,60,79,0,-120,0,-120,120,-60,-120,
+    60,-60,-120,-120,120,60,120,60,0,38,0,-60,-60,60,0,120,
+    0,-60,210,180,120,-120,0,-120,240,-60,-120,44,-60,-120,-120,60,
+    0,60,0,-60,210,-60,-120,-120,0,-60,240,-60,-120,210,101,0,
+    30,142,0,240,120,0,85,120,0,-60,120,-60,240,70,-60,210,
+    101,0,-60,76,0,240,60,-60,101,120,60,-60,92,-60,240,67,
+    -60,101,89,-60,49,180,-60,240,89,-60,210,38,-60,-60,92,0,
+    240,67,-60,210,120,0,-60,79,-60,240,54,-60,85,120,-60,-60,
+    120,60,240,73,0,210,38,-60,-60,120,0,240,120,-60,51,92,
+    0,-180,92,-60,120,67,-60,51,0,-60,-180,120,0,120,60,0,
+    29,51,-60,-180,120,60,120,60,-60,51,70,0,-180,120,60,120,
+    120,0,51,120,60,-180,120,-180,240,-120,-180,210,120,60,-180,-60,
+    -120,240,-120,-180,210,120,0,0,120,0,240,60,0,19,0,-60,
+    -180,0,-60,24,-60,-120,210,60,0,-180,-60,-120,240,-120,-180,210,
+    120,60,-60,76,-60,240,54,-60,85,73,-60,33,120,-60,240,73,
+    -60,210,38,-60,-60,76,0,240,60,-60,35,38,-60,-180,60,-60,
+    60,60,-60,35,60,-60,-180,60,0,60,0,-60,13,60,0,-120,
+    0,-60,60,-60,-120,210,38,-60,14,79,-60,240,54,-60,19,0,
+    -60,-180,0,-60,24,-60,-120,210,38,-60,-180,-60,-120,240,-120,-180,
+    35,95,-6,-180,95,-60,180,70,-60,57,0,-60,-180,136,-60,180,
+    92,-60,35,57,-60,-180,95,0,180,70,-60,35,54,-60,-180,60,
+    0,60,60,-60,35,60,0,-180,60,-180,180,-120,-180,51,60,0,
+    -180,-60,-120,180,-120,-180,35,57,-60,-180,98,-60,180,73,-60,19,
+    0,-60,-180,0,-60,24,-60,-120,35,57,-60,-180,-60,-120,180,-120,
+    -180,51,73,-6,-180,114,0,180,89,-6,19,0,-60,-180,0,-180,
+    180,-120,-180,51,73,0,-180,-60,-120,180,-120,-180,73,92,32,-180,
+    -60,-180,180,-120,-180,73,-120,-180,-180,180,120,180,120,60,51,60,
+    0,0,120,60,180,60,0,35,76,16,-60,60,-60,180,0,-60,
+    57,0,-60,-60,120,60,120,60,0,35,0,-60,-60,60,0,180,
+    0,-60,51,60,-22,-120,98,0,180,73,-22,41,60,0,-120,60,
+    -120,180,-60,-120,19,60,0,-120,0,-60,180,-60,-120,19,76,0,
+    -120,0,-120,120,-60,-120,57,-60,-120,-120,120,60,120,60,0,35,
+    0,-60,-60,60,0,120,0,-60,19,60,0,-120,0,-120,180,-60,
+    -120,41,-60,-120,-120,60,0,60,0,-60,19,-60,-120,-120,0,-60,
+    180,-60,-120,210,139,60,0,120,0,240,60,0,123,70,0,30,
+    180,0,240,70,0,210,60,0,0,120,60,240,60,0,35,54,
+    -60,-180,60,0,60,60,-60,35,60,0,-180,60,-180,240,-120,-180,
+    210,120,60,-180,-60,-120,240,-120,-180,210,60,0,11,120,0,240,
+    60,0,19,0,-60,-180,0,-60,24,-60,-120,210,60,0,-180,-60,
+    -120,240,-120,-180,29,51,-60,-180,92,-60,120,67,-60,19,0,-60,
+    -180,0,-180,120,-120,-180,29,51,-60,-180,-60,-120,120,-120,-180,51,
+    70,0,-180,-60,-180,120,-120,-180,51,-120,-180,-180,120,60,120,60,
+    0,29,0,-60,-60,60,0,120,0,-60,13,54,-6,-120,0,-120,
+    120,-60,-120,35,-60,-120,-120,60,0,60,0,-60,13,-60,-120,-120,
+    0,-60,120,-60,-120,210,120,60,60,180,60,240,120,60,19,0,
+    -60,-180,0,-180,240,-120,-180,210,120,60,-180,-60,-120,240,-120,-180,
+    35,54,-60,-180,-60,-180,60,-120,-180,35,-120,-180,-180,60,0,60,
+    0,-60,13,-60,-120,-120,0,-60,60,-60,-120,210,180,120,-180,-60,
+    -180,240,-120,-180,19,-120,-180,-180,0,-60,24,-60,-120,210,-120,-180,
+    -180,-60,-120,240,-120,-180,-210,0,-120,-240,0,-142,-55,0,-142,-210,
+    -6,-139,-240,60,-139,60,-6,-139,-85,0,-142,-240,60,-95,-36,60,
+    -142,-210,-3,-180,-240,35,-120,-17,0,-120,-210,32,-120,-240,60,-180,
+    -52,-6,-180,-85,0,-180,-240,-3,-98,-52,-60,-180,-101,-60,-120,-240,
+    60,-139,60,60,-139,-210,60,-139,-240,60,-92,60,-22,-117,-101,60,
+    -139,-240,60,-114,-74,60,-180,-210,-60,-180,-240,60,-120,60,60,-180,
+    -210,32,-120,-240,60,-180,60,-60,-180,-85,0,-180,-240,0,-98,-58,
+    -60,-180,-210,35,-180,-240,35,-180,-39,0,-180,-210,32,-180,-240,120,
+    -180,120,32,-180,-73,-120,-180,-240,35,-60,120,0,-180,-73,-32,-180,
+    -240,-60,-180,120,-60,-180,-210,-60,-180,-240,60,-54,60,0,-79,-73,
+    -120,-180,-240,0,-76,120,-60,-180,-76,-35,-120,-240,3,-120,-33,0,
+    -120,-210,0,-79,-240,0,-180,-52,-60,-180,-76,0,-120,-240,0,-92,
+    -52,0,-180,-210,0,-180,-240,0,-180,-52,0,-180,-210,0,-180,-240,
+    120,-54,120,16,-79,-44,-6,-120,-120,19,-76,120,-6,-120,-76,-35,
+    -95,-240,-60,-180,-52,-60,-180,-210,-60,-180,-240,120,-70,120,0,-95,
+    -76,-120,-180,-240,120,-92,-52,120,-180,-210,-60,-139,-240,0,-101,-14,
+    0,-120,-210,0,-60,-240,0,-139,-33,-60,-139,-123,0,-101,-240,0,
+    -95,-55,0,-180,-210,0,-120,-240,0,-120,-36,-60,-120,-210,-60,-120,
+    -240,120,-120,120,-60,-120,-51,-60,-120,-120,0,-60,120,-60,-120,-60,
+    0,-79,-240,0,-139,-33,-60,-139,-210,-60,-139,-240,60,-51,60,0,
+    -76,-60,-60,-139,-240,0,-73,-33,-60,-139,-210,-60,-120,-240,-60,-120,
+    -60,-60,-180,-210,-60,-120,-240,120,-60,120,0,-60,-44,0,-101,-240,
+    60,-57,-17,0,-101,-210,-120,-180,-240,120,-38,2,60,-63,-210,120,
+    -22,-240,120,-240,-210,-180,-240,-210,-120,-180,-240,-120,-180,-210,-180,-240,
+    -210,-120,-180,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,-60,-120,-60,
+    -120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-60,-139,-240,-60,
+    -180,-115,-60,-180,-210,-60,-139,-240,0,-120,0,-60,-120,-123,-120,-180,
+    -240,0,-60,0,-60,-180,-210,-120,-180,-240,0,-120,0,-60,-120,-210,
+    -60,-120,-240,0,-60,0,-60,-120,-123,0,-60,-180,-60,-120,0,-120,
+    -180,-210,-120,-180,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,-60,-120,
+    -60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-60,-142,-240,
+    0,-136,0,0,-142,-210,0,-101,-240,0,-180,0,-60,-180,-123,0,
+    -136,-240,0,-136,-96,0,-180,-210,0,-180,-240,0,-120,-77,-60,-142,
+    -210,0,-101,-240,60,-180,60,0,-180,-85,-120,-180,-240,0,-60,60,
+    -60,-180,-101,-60,-120,-180,-60,-180,60,-60,-180,-210,-60,-180,-240,60,
+    0,60,0,-60,-101,-120,-180,-240,60,0,60,60,-180,-210,-60,-180,
+    -240,-60,-120,-77,-60,-180,-210,-60,-120,-240,60,-180,60,0,-180,-85,
+    -120,-180,-240,60,0,60,60,-180,-210,-120,-180,-240,60,-180,60,60,
+    -180,-210,60,-180,-240,60,0,60,0,-60,-85,60,0,-120,0,-60,
+    60,-60,-120,-101,-60,-120,-180,60,-60,60,0,-60,-79,0,-60,-180,
+    0,-60,0,-60,-120,-101,0,-60,-180,-60,-120,60,-120,-180,-210,-60,
+    -139,-240,-60,-180,-115,-60,-180,-210,-60,-139,-240,0,-180,0,-60,-180,
+    -123,-120,-180,-240,0,-60,0,0,-180,-210,-120,-180,-240,0,-180,0,
+    0,-180,-210,0,-180,-240,0,-60,0,-60,-120,-123,0,-60,-180,-60,
+    -120,0,-120,-180,-210,-120,-180,-240,-60,-180,-60,-60,-180,-210,-60,-180,
+    -240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,
+    -60,-142,-240,0,-120,-30,0,-142,-210,0,-101,-240,0,-180,-49,-60,
+    -180,-123,0,-136,-240,0,-136,-96,0,-180,-210,0,-120,-240,0,-120,
+    -77,-60,-142,-210,0,-120,-240,60,-120,60,0,-120,-85,-60,-120,-240,
+    0,-73,60,-60,-120,-101,-60,-120,-240,-60,-180,-49,-60,-180,-210,-60,
+    -180,-240,60,-67,60,0,-92,-101,-120,-180,-240,60,-89,-49,60,-180,
+    -210,-60,-120,-240,-60,-120,-77,-60,-180,-210,-60,-120,-240,60,-60,60,
+    0,-76,-85,-60,-120,-240,60,-73,-33,0,-120,-210,-120,-180,-240,60,
+    -54,-14,60,-79,-210,60,-38,-240,60,-240,-210,-180,-240,-210,-120,-180,
+    -240,-120,-180,-210,-180,-240,-210,-120,-180,-240,-60,-120,-60,-60,-180,-210,
+    -60,-120,-240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,
+    -240,-210,-60,-139,-240,-60,-180,-115,-60,-180,-210,-60,-139,-240,0,-120,
+    0,-60,-120,-123,-120,-180,-240,0,-60,0,0,-180,-210,-120,-180,-240,
+    0,-120,0,0,-120,-210,0,-120,-240,0,-60,0,-60,-120,-123,0,
+    -60,-180,-60,-120,0,-120,-180,-210,-120,-180,-240,-60,-120,-60,-60,-180,
+    -210,-60,-120,-240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,-210,
+    -180,-240,-210,-60,-139,-240,-60,-180,-115,-60,-180,-210,-60,-139,-240,0,
+    -60,0,-60,-120,-123,-120,-180,-240,0,-70,-30,0,-180,-210,-120,-180,
+    -240,0,-60,-11,0,-120,-210,0,-60,-240,0,-240,-210,-180,-240,-210,
+    -120,-180,-240,-120,-180,-210,-180,-240,-210,-120,-180,-240,-60,-120,-60,-60,
+    -180,-210,-60,-120,-240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,
+    -210,-180,-240,-210,-120,-180,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,
+    -60,-240,-210,-180,-240,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-120,
+    -180,-240,-120,-240,-210,-180,-240,-210,-180,-240,-240,180,120,180,120,60,
+    -19,60,0,-24,120,60,180,60,0,-35,60,-54,-60,60,-60,180,
+    0,-60,-13,0,-60,-60,120,60,120,60,0,-35,0,-60,-60,60,
+    0,180,0,-60,-51,0,-92,-120,60,-67,180,60,-92,-29,60,-51,
+    -120,60,-120,180,-60,-120,-51,60,0,-120,0,-60,180,-60,-120,-51,
+    6,-54,-120,0,-120,120,-60,-120,-13,-60,-120,-120,120,60,120,60,
+    0,-35,0,-60,-60,60,0,120,0,-60,-51,0,-70,-120,0,-120,
+    180,-60,-120,-29,-60,-120,-120,60,0,60,0,-60,-51,-60,-120,-120,
+    0,-60,180,-60,-120,-57,6,-95,-180,6,-136,180,0,-136,-51,0,
+    -95,-180,60,-70,180,0,-95,-57,0,-136,-180,60,-92,180,60,-136,
+    -35,-16,-98,-180,60,-73,60,60,-98,-35,60,-57,-180,60,-180,180,
+    -120,-180,-73,60,0,-180,-60,-120,180,-120,-180,-73,-32,-92,-180,60,
+    -60,180,0,-60,-51,0,-60,-180,0,-60,0,-60,-120,-73,0,-60,
+    -180,-60,-120,180,-120,-180,-73,-32,-98,-180,22,-73,120,0,-98,-51,
+    0,-60,-180,0,-180,120,-120,-180,-73,0,-60,-180,-60,-120,120,-120,
+    -180,-73,0,-60,-180,-60,-180,120,-120,-180,-19,-120,-180,-180,120,60,
+    120,60,0,-41,0,-60,-60,60,0,120,0,-60,-57,0,-76,-120,
+    0,-120,120,-60,-120,-35,-60,-120,-120,60,0,60,0,-60,-57,-60,
+    -120,-120,0,-60,120,-60,-120,-73,-32,-114,-180,6,-89,180,0,-114,
+    -51,0,-73,-180,0,-180,180,-120,-180,-73,60,0,-180,-60,-120,180,
+    -120,-180,-73,-16,-76,-180,-60,-180,60,-120,-180,-35,-120,-180,-180,60,
+    0,60,0,-60,-57,-60,-120,-120,0,-60,60,-60,-120,-73,-32,-92,
+    -180,-60,-180,180,-120,-180,-51,-120,-180,-180,0,-60,0,-60,-120,-73,
+    -120,-180,-180,-60,-120,180,-120,-180,-210,-60,-142,-240,0,-142,-55,0,
+    -142,-210,-6,-120,-240,0,-180,-74,-60,-180,-123,0,-142,-240,0,-136,
+    -96,0,-180,-210,-3,-180,-240,-3,-180,-77,-60,-180,-210,-6,-180,-240,
+    60,-180,60,-6,-180,-85,-120,-180,-240,-3,-98,60,-60,-180,-101,-60,
+    -120,-240,-60,-180,-74,-60,-180,-210,-60,-180,-240,60,-92,60,-22,-117,
+    -101,-120,-180,-240,60,-114,-74,60,-180,-210,-60,-120,-240,-60,-142,-77,
+    -60,-180,-210,-60,-120,-240,60,-120,60,-60,-120,-85,-60,-142,-240,0,
+    -98,-58,-60,-142,-210,-120,-180,-240,60,-79,-39,0,-104,-210,60,-63,
+    -240,60,-240,-210,-180,-240,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,
+    -120,-180,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,-60,-120,-60,-120,
+    -180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-60,-139,-240,-60,-180,
+    -115,-60,-180,-210,-60,-139,-240,0,-180,0,-60,-180,-123,-120,-180,-240,
+    0,-60,0,0,-180,-210,-120,-180,-240,0,-180,0,0,-180,-210,0,
+    -180,-240,0,-60,0,-60,-120,-123,0,-60,-180,-60,-120,0,-120,-180,
+    -210,-120,-180,-240,-60,-180,-60,-60,-180,-210,-60,-180,-240,-60,-120,-60,
+    -120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-60,-139,-240,-60,
+    -180,-115,-60,-180,-210,-60,-139,-240,0,-120,0,-60,-120,-123,-120,-180,
+    -240,0,-95,-55,0,-180,-210,-120,-180,-240,0,-76,-36,0,-120,-210,
+    0,-60,-240,0,-240,-210,-180,-240,-210,-120,-180,-240,-120,-180,-210,-180,
+    -240,-210,-120,-180,-240,-60,-120,-60,-60,-180,-210,-60,-120,-240,-60,-120,
+    -60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-120,-180,-240,
+    -60,-120,-60,-60,-180,-210,-60,-120,-240,-60,-240,-210,-180,-240,-210,-120,
+    -180,-240,-120,-180,-210,-180,-240,-210,-120,-180,-240,-120,-240,-210,-180,-240,
+    -210,-180,-240,-240,120,60,120,60,0,-44,0,-60,-60,60,0,120,
+    0,-60,-60,0,-79,-120,0,-120,120,-60,-120,-38,-60,-120,-120,60,
+    0,60,0,-60,-60,-60,-120,-120,0,-60,120,-60,-120,-76,-35,-117,
+    -180,3,-92,120,0,-117,-54,0,-76,-180,0,-180,120,-120,-180,-76,
+    0,-60,-180,-60,-120,120,-120,-180,-76,-19,-79,-180,-60,-180,60,-120,
+    -180,-38,-120,-180,-180,60,0,60,0,-60,-60,-60,-120,-120,0,-60,
+    60,-60,-120,-76,-35,-95,-180,-60,-180,120,-120,-180,-54,-120,-180,-180,
+    0,-60,0,-60,-120,-76,-120,-180,-180,-60,-120,120,-120,-180,-210,-60,
+    -142,-240,-60,-180,-115,-60,-180,-210,-60,-180,-240,0,-180,0,-60,-180,
+    -123,-120,-180,-240,0,-136,-96,0,-180,-210,-120,-180,-240,0,-120,-77,
+    -60,-142,-210,0,-101,-240,0,-240,-210,-180,-240,-210,-120,-180,-240,-120,
+    -180,-210,-180,-240,-210,-120,-180,-240,-60,-180,-60,-60,-180,-210,-60,-180,
+    -240,-60,-120,-60,-120,-180,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,
+    -120,-180,-240,-60,-120,-77,-60,-180,-210,-60,-120,-240,-60,-240,-210,-180,
+    -240,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-120,-180,-240,-120,-240,
+    -210,-180,-240,-210,-180,-240,-240,60,0,60,0,-60,-85,-60,-120,-120,
+    0,-60,60,-60,-120,-101,-60,-120,-180,-60,-180,60,-120,-180,-79,-120,
+    -180,-180,0,-60,0,-60,-120,-101,-120,-180,-180,-60,-120,60,-120,-180,
+    -210,-120,-180,-240,-60,-180,-115,-60,-180,-210,-60,-139,-240,-60,-240,-210,
+    -180,-240,-210,-120,-180,-240,-120,-180,-210,-180,-240,-210,-120,-180,-240,-120,
+    -240,-210,-180,-240,-210,-180,-240,-240,0,-60,0,-60,-120,-123,-120,-180,
+    -180,-60,-120,0,-120,-180,-210,-120,-180,-240,-120,-240,-210,-180,-240,-210,
+    -180,-240,-240,-60,-120,-60,-120,-180,-210,-180,-240,-240,-120,-180,-210,-180,
+    -240
+}
+};
@@ -0,0 +1,122 @@
+// Generates edge_table.h, the value of every configuration of an edge.
+// usage: ./edge_table_gen > edge_table.h
+//
+// An edge is solved as a game of its own: the side to move may put a disc
+// on any empty square of the edge (the flips it makes in the other
+// directions happen off the edge, so the move is assumed to be available)
+// except on a corner, which has to flip along the edge. It may also pass,
+// which stands for playing elsewhere, and two passes in a row end the game.
+// The edge is then scored for black: a stable disc is worth STABLE, the
+// others the value of their square.
+#include <iostream>
+#include <algorithm>
+
+using namespace std;
+const int SIZE = 8;
+const int CONFIGS = 6561;
+const int EMPTY = 0, BLACK = 1, WHITE = 2;
+const int STABLE = 30;
+const int square_value[SIZE] = {30, -5, 11, 8, 8, 11, -5, 30};
+// memo[side - 1][passed][config], valid once known is set
+int memo[2][2][CONFIGS];
+bool known[2][2][CONFIGS];
+
+int encode(const int* c){
+    int idx = 0;
+    for(int i=0;i<SIZE;i++){
+        idx = idx * 3 + c[i];
+    }
+    return idx;
+}
+// a disc is stable when the line is full or the discs from it to an end of
+// the edge are all its colour, nothing can bracket it then
+int score(const int* c){
+    bool full = std::find(c,c+SIZE,EMPTY) == c+SIZE;
+    int sum = 0;
+    for(int i=0;i<SIZE;i++){
+        if(c[i] == EMPTY){
+            continue;
+        }
+        bool left = true, right = true;
+        for(int j=0;j<i;j++){
+            left = left && c[j] == c[i];
+        }
+        for(int j=i+1;j<SIZE;j++){
+            right = right && c[j] == c[i];
+        }
+        int value = full || left || right ? STABLE : square_value[i];
+        sum += c[i] == BLACK ? value : -value;
+    }
+    return sum;
+}
+// put a disc of side on square i, returns the number of flipped discs
+int play(int* c , int side , int i){
+    int flipped = 0;
+    for(int dir=-1;dir<=1;dir+=2){
+        int j = i + dir;
+        while(0 <= j && j < SIZE && c[j] == 3 - side){
+            j += dir;
+        }
+        if(0 <= j && j < SIZE && c[j] == side){
+            for(int k=i+dir;k!=j;k+=dir){
+                c[k] = side;
+                flipped++;
+            }
+        }
+    }
+    c[i] = side;
+    return flipped;
+}
+// black maximises, white minimises
+int solve(int* c , int side , int passed){
+    int idx = encode(c);
+    if(known[side-1][passed][idx]){
+        return memo[side-1][passed][idx];
+    }
+    int best;
+    if(passed){
+        best = score(c);
+    }
+    else{
+        best = solve(c,3 - side,1);
+    }
+    for(int i=0;i<SIZE;i++){
+        if(c[i] != EMPTY){
+            continue;
+        }
+        int next[SIZE];
+        std::copy(c,c+SIZE,next);
+        int flipped = play(next,side,i);
+        if((i == 0 || i == SIZE - 1) && flipped == 0){
+            continue;
+        }
+        int value = solve(next,3 - side,0);
+        best = side == BLACK ? std::max(best,value) : std::min(best,value);
+    }
+    known[side-1][passed][idx] = true;
+    memo[side-1][passed][idx] = best;
+    return best;
+}
+
+int main(){
+    cout << "// Generated by edge_table_gen.cpp, do not edit.\n";
+    cout << "// edge_table[side to move - 1][edge] is the value of an edge for black,\n";
+    cout << "// the edge read as a base 3 number from one corner to the other.\n";
+    cout << "const short edge_table[2][" << CONFIGS << "] = {\n";
+    for(int side=BLACK;side<=WHITE;side++){
+        cout << "{";
+        for(int idx=0;idx<CONFIGS;idx++){
+            int c[SIZE];
+            for(int i=SIZE-1,rest=idx;i>=0;i--,rest/=3){
+                c[i] = rest % 3;
+            }
+            if(idx % 16 == 0){
+                cout << "\n    ";
+            }
+            cout << solve(c,side,0) << (idx + 1 < CONFIGS ? "," : "");
+        }
+        cout << "\n}" << (side == BLACK ? "," : "") << "\n";
+    }
+    cout << "};\n";
+    return 0;
+}
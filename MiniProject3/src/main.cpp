@@ -5,6 +5,28 @@
 #include <array>
 #include <vector>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include "player_abi.h"
+#if defined(__linux__) || defined(__APPLE__)
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <cerrno>
+#include <cstring>
+#include <dlfcn.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <spawn.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define HAVE_POSIX 1
+extern char** environ;
+#endif
 
 struct Point {
     int x, y;
@@ -234,22 +256,381 @@ const std::string file_action = "action";
 // Timeout is set to 10 when TA test your code.
 const int timeout = 1;
 
-void launch_executable(std::string filename) {
+// A player that is still running at the deadline gets SIGTERM, and SIGKILL
+// if it is still there kill_grace_ms later.
+const int kill_grace_ms = 100;
+
+// How one move went: seconds from launch to exit, CPU seconds of the
+// player (negative when unknown) and how it ended.
+struct MoveTiming {
+    double wall = 0, cpu = -1;
+    std::string status = "exit 0";
+    std::string encode() const {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << "Time: wall " << wall << "s";
+        if (cpu >= 0)
+            ss << " cpu " << cpu << "s";
+        ss << " " << status << "\n";
+        return ss.str();
+    }
+};
+
+double seconds_since(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+#ifdef HAVE_POSIX
+double cpu_seconds(const rusage& usage) {
+    return usage.ru_utime.tv_sec + usage.ru_utime.tv_usec * 1e-6 + \
+        usage.ru_stime.tv_sec + usage.ru_stime.tv_usec * 1e-6;
+}
+
+// Waits for a child to exit with a deadline. wait4 has no timeout, so a
+// thread blocks until the child exits, without reaping it (WNOWAIT) so its
+// pid can't be reused under a kill while the waiter lives. The child must
+// have exited before the waiter goes, kill it if need be.
+struct ExitWaiter {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool exited = false;
+    std::thread thread;
+    explicit ExitWaiter(pid_t pid) : thread([this, pid]() {
+        siginfo_t info;
+        while (waitid(P_PID, pid, &info, WEXITED | WNOWAIT) != 0 && errno == EINTR)
+            ;
+        std::lock_guard<std::mutex> lock(mutex);
+        exited = true;
+        cv.notify_one();
+    }) {}
+    ~ExitWaiter() {
+        thread.join();
+    }
+    // false if the child is still there at the deadline
+    bool wait_until(std::chrono::steady_clock::time_point deadline) {
+        std::unique_lock<std::mutex> lock(mutex);
+        return cv.wait_until(lock, deadline, [this]() { return exited; });
+    }
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return exited; });
+    }
+};
+#endif
+
+MoveTiming launch_executable(std::string filename) {
+    MoveTiming timing;
+    auto start = std::chrono::steady_clock::now();
 #if defined(WIN32) || defined(_WIN32) || defined(__WIN32__) || defined(__NT__)
     std::string command = "start /min " + filename + " " + file_state + " " + file_action;
     std::string kill = "timeout /t " + std::to_string(timeout) + " > NUL && taskkill /im " + filename + " > NUL 2>&1";
     system(command.c_str());
     system(kill.c_str());
-#elif __linux__
-    std::string command = "timeout " + std::to_string(timeout) + "s " + filename + " " + file_state + " " + file_action;
-    system(command.c_str());
-#elif __APPLE__
-    // May require installing the command by:
-    // brew install coreutils
-    std::string command = "gtimeout " + std::to_string(timeout) + "s " + filename + " " + file_state + " " + file_action;
-    system(command.c_str());
+    timing.status = "unknown";
+#elif defined(HAVE_POSIX)
+    // the player runs without a shell, its words are the arguments
+    std::vector<std::string> args;
+    std::stringstream words(filename);
+    std::string word;
+    while (words >> word)
+        args.push_back(word);
+    args.push_back(file_state);
+    args.push_back(file_action);
+    std::vector<char*> argv;
+    for (auto& arg : args)
+        argv.push_back(&arg[0]);
+    argv.push_back(nullptr);
+    pid_t pid;
+    if (posix_spawnp(&pid, argv[0], nullptr, nullptr, argv.data(), environ) != 0) {
+        timing.status = "spawn failed";
+        return timing;
+    }
+    auto deadline = start + std::chrono::seconds(timeout);
+    bool terminated = false;
+    {
+        ExitWaiter waiter(pid);
+        if (!waiter.wait_until(deadline)) {
+            kill(pid, SIGTERM);
+            terminated = true;
+            if (!waiter.wait_until(deadline + std::chrono::milliseconds(kill_grace_ms))) {
+                kill(pid, SIGKILL);
+                waiter.wait();
+            }
+        }
+    }
+    timing.wall = seconds_since(start);
+    int status = 0;
+    rusage usage = rusage();
+    pid_t reaped;
+    while ((reaped = wait4(pid, &status, 0, &usage)) < 0 && errno == EINTR)
+        ;
+    if (reaped < 0) {
+        timing.status = std::string("wait failed: ") + strerror(errno);
+        return timing;
+    }
+    timing.cpu = cpu_seconds(usage);
+    if (terminated)
+        timing.status = "timeout";
+    else if (WIFSIGNALED(status))
+        timing.status = "signal " + std::to_string(WTERMSIG(status));
+    else
+        timing.status = "exit " + std::to_string(WEXITSTATUS(status));
+    return timing;
+#endif
+    timing.wall = seconds_since(start);
+    return timing;
+}
+// moves, seconds and the slowest move of one player over the game
+struct PlayerTiming {
+    int moves = 0;
+    double wall = 0, cpu = -1, slowest = 0;
+    void add(const MoveTiming& t) {
+        moves++;
+        wall += t.wall;
+        if (t.cpu >= 0)
+            cpu = std::max(0.0, cpu) + t.cpu;
+        slowest = std::max(slowest, t.wall);
+    }
+    std::string encode() const {
+        std::stringstream ss;
+        ss << std::fixed << std::setprecision(3) << "moves " << moves << " wall " << wall << "s avg " << \
+            wall / std::max(1, moves) << "s max " << slowest << "s";
+        if (cpu >= 0)
+            ss << " cpu " << cpu << "s";
+        ss << "\n";
+        return ss.str();
+    }
+};
+
+// Players given as "pipe:<command>" are started once, through the shell
+// (which execs the command), and kept for the whole game. Every turn the referee writes the state to
+// their stdin in the format of the state file, and the first "x y" line on
+// their stdout is the move. No line within the timeout counts as an invalid
+// move. At the end of the game their stdin is closed. my_project speaks
+// this protocol with --ponder, e.g. "pipe:./my_project --ponder".
+const std::string pipe_prefix = "pipe:";
+
+#ifdef HAVE_POSIX
+struct PipePlayer {
+    pid_t pid = -1;
+    // the player's stdin and stdout
+    int to = -1, from = -1;
+    // what was read after the last move
+    std::string pending;
+};
+
+// a pipe whose ends are closed on exec, so no other player inherits them
+// (a player holding another's stdin keeps it from seeing the end of input)
+bool cloexec_pipe(int fds[2]) {
+    if (pipe(fds) != 0)
+        return false;
+    fcntl(fds[0], F_SETFD, FD_CLOEXEC);
+    fcntl(fds[1], F_SETFD, FD_CLOEXEC);
+    return true;
+}
+
+bool start_player(const std::string& command, PipePlayer& player) {
+    int in[2], out[2];
+    if (!cloexec_pipe(in))
+        return false;
+    if (!cloexec_pipe(out)) {
+        close(in[0]); close(in[1]);
+        return false;
+    }
+    // exec so the pid, and the kill in stop_player, is the player's
+    std::string line = "exec " + command;
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(in[0]); close(in[1]); close(out[0]); close(out[1]);
+        return false;
+    }
+    if (pid == 0) {
+        // dup2 clears close-on-exec on the player's stdin and stdout
+        dup2(in[0], STDIN_FILENO);
+        dup2(out[1], STDOUT_FILENO);
+        execl("/bin/sh", "sh", "-c", line.c_str(), (char*)nullptr);
+        _exit(127);
+    }
+    close(in[0]);
+    close(out[1]);
+    player.pid = pid;
+    player.to = in[1];
+    player.from = out[0];
+    return true;
+}
+
+// the player's move for state, (-1, -1) if none came before the deadline.
+// The player keeps running, so only the wall time of the move is known.
+Point ask_player(PipePlayer& player, const std::string& state, MoveTiming& timing) {
+    Point p(-1, -1);
+    auto start = std::chrono::steady_clock::now();
+    timing.status = "closed";
+    size_t written = 0;
+    while (written < state.size()) {
+        ssize_t n = write(player.to, state.data() + written, state.size() - written);
+        if (n <= 0)
+            return p;
+        written += n;
+    }
+    auto deadline = start + std::chrono::seconds(timeout);
+    size_t line;
+    while ((line = player.pending.find('\n')) == std::string::npos) {
+        auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now()).count();
+        pollfd fd = {player.from, POLLIN, 0};
+        if (left <= 0 || poll(&fd, 1, (int)left) <= 0) {
+            timing.status = "timeout";
+            timing.wall = seconds_since(start);
+            return p;
+        }
+        char buffer[256];
+        ssize_t n = read(player.from, buffer, sizeof(buffer));
+        if (n <= 0) {
+            timing.wall = seconds_since(start);
+            return p;
+        }
+        player.pending.append(buffer, n);
+    }
+    timing.status = "answered";
+    timing.wall = seconds_since(start);
+    std::stringstream ss(player.pending.substr(0, line));
+    player.pending.erase(0, line + 1);
+    int x, y;
+    if (ss >> x >> y) {
+        p.x = x; p.y = y;
+    }
+    return p;
+}
+
+// closes the player's stdin, and kills it if it is still there after a
+// second
+void stop_player(PipePlayer& player) {
+    if (player.pid < 0)
+        return;
+    close(player.to);
+    close(player.from);
+    {
+        ExitWaiter waiter(player.pid);
+        if (!waiter.wait_until(std::chrono::steady_clock::now() + std::chrono::seconds(1))) {
+            kill(player.pid, SIGKILL);
+            waiter.wait();
+        }
+    }
+    while (waitpid(player.pid, nullptr, 0) < 0 && errno == EINTR)
+        ;
+    player.pid = -1;
+}
 #endif
+
+// Players given as "lib:<path>" are shared libraries with the C interface of
+// player_abi.h, e.g. "lib:./player_lib.so". A move is a call to their
+// choose in this process, without a launch or files. The referee calls their
+// stop at the deadline and an answer after it is an invalid move. A call
+// can't be taken back: a player still in it kill_grace_ms after the
+// deadline loses the game and is left alone, it is never called or unloaded
+// again.
+const std::string lib_prefix = "lib:";
+
+#ifdef HAVE_POSIX
+struct LibPlayer {
+    void* library = nullptr;
+    OthelloPlayer* player = nullptr;
+    othello_player_choose_fn choose = nullptr;
+    othello_player_stop_fn stop = nullptr;
+    othello_player_shutdown_fn shutdown = nullptr;
+    // a call of it never returned, its thread may still be in the library
+    bool hung = false;
+};
+
+bool load_player(const std::string& path, LibPlayer& player) {
+    player.library = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (!player.library) {
+        std::cerr << dlerror() << "\n";
+        return false;
+    }
+    auto init = (othello_player_init_fn)dlsym(player.library, "othello_player_init");
+    player.choose = (othello_player_choose_fn)dlsym(player.library, "othello_player_choose");
+    player.stop = (othello_player_stop_fn)dlsym(player.library, "othello_player_stop");
+    player.shutdown = (othello_player_shutdown_fn)dlsym(player.library, "othello_player_shutdown");
+    if (!init || !player.choose || !player.stop || !player.shutdown)
+        return false;
+    player.player = init(OTHELLO_PLAYER_ABI_VERSION);
+    return player.player != nullptr;
+}
+
+void unload_player(LibPlayer& player) {
+    if (player.hung)
+        return;
+    if (player.player)
+        player.shutdown(player.player);
+    if (player.library)
+        dlclose(player.library);
+    player = LibPlayer();
+}
+
+// One call into a library player. The call runs on a thread of its own and
+// shares this with it, so the referee can walk away from a call that never
+// returns.
+struct LibCall {
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    int result = 0, x = -1, y = -1;
+    std::chrono::steady_clock::time_point finished;
+};
+
+// the player's move for state, (-1, -1) on an error or after the deadline.
+// The referee's thread keeps the deadline while the call runs: it calls the
+// player's stop at the deadline, and a call still running kill_grace_ms
+// later is left behind and the player marked hung. The CPU time is the
+// whole process's, the referee's share is tiny.
+Point ask_library(LibPlayer& player, const std::string& state, MoveTiming& timing) {
+    Point p(-1, -1);
+    rusage before, after;
+    getrusage(RUSAGE_SELF, &before);
+    auto start = std::chrono::steady_clock::now();
+    auto deadline = start + std::chrono::seconds(timeout);
+    auto call = std::make_shared<LibCall>();
+    LibPlayer lib = player;
+    std::thread worker([call, lib, state]() {
+        int x = -1, y = -1;
+        int result = lib.choose(lib.player, state.c_str(), timeout * 1000, &x, &y);
+        std::lock_guard<std::mutex> lock(call->mutex);
+        call->done = true;
+        call->result = result;
+        call->x = x;
+        call->y = y;
+        call->finished = std::chrono::steady_clock::now();
+        call->cv.notify_one();
+    });
+    std::unique_lock<std::mutex> lock(call->mutex);
+    if (!call->cv.wait_until(lock, deadline, [&]() { return call->done; })) {
+        lock.unlock();
+        player.stop(player.player);
+        lock.lock();
+        call->cv.wait_until(lock, deadline + std::chrono::milliseconds(kill_grace_ms), [&]() { return call->done; });
+    }
+    bool done = call->done;
+    lock.unlock();
+    timing.wall = seconds_since(start);
+    if (!done) {
+        worker.detach();
+        player.hung = true;
+        timing.status = "hung";
+        return p;
+    }
+    worker.join();
+    getrusage(RUSAGE_SELF, &after);
+    timing.cpu = cpu_seconds(after) - cpu_seconds(before);
+    if (call->result != 0) {
+        timing.status = "error " + std::to_string(call->result);
+    } else if (call->finished > deadline) {
+        timing.status = "timeout";
+    } else {
+        timing.status = "returned";
+        p.x = call->x; p.y = call->y;
+    }
+    return p;
 }
+#endif
 
 int main(int argc, char** argv) {
     assert(argc == 3);
@@ -259,32 +640,76 @@ int main(int argc, char** argv) {
     player_filename[2] = argv[2];
     std::cout << "Player Black File: " << player_filename[OthelloBoard::BLACK] << std::endl;
     std::cout << "Player White File: " << player_filename[OthelloBoard::WHITE] << std::endl;
+#ifdef HAVE_POSIX
+    // a player that quits must not take the referee with it
+    signal(SIGPIPE, SIG_IGN);
+    PipePlayer pipe_player[3];
+    LibPlayer lib_player[3];
+    for (int i = 1; i <= 2; i++) {
+        if (player_filename[i].compare(0, pipe_prefix.size(), pipe_prefix) == 0 && \
+            !start_player(player_filename[i].substr(pipe_prefix.size()), pipe_player[i])) {
+            std::cerr << "Error starting player: " << player_filename[i] << "\n";
+            return 1;
+        }
+        if (player_filename[i].compare(0, lib_prefix.size(), lib_prefix) == 0 && \
+            !load_player(player_filename[i].substr(lib_prefix.size()), lib_player[i])) {
+            std::cerr << "Error loading player: " << player_filename[i] << "\n";
+            return 1;
+        }
+    }
+#else
+    for (int i = 1; i <= 2; i++) {
+        if (player_filename[i].compare(0, pipe_prefix.size(), pipe_prefix) == 0 || \
+            player_filename[i].compare(0, lib_prefix.size(), lib_prefix) == 0) {
+            std::cerr << "pipe and lib players are not supported on this platform\n";
+            return 1;
+        }
+    }
+#endif
     OthelloBoard game;
     std::string data;
     data = game.encode_output();
     std::cout << data;
     log << data;
+    PlayerTiming player_timing[3];
+    // only file protocol players leave a state file
+    bool state_written = false;
     while (!game.done) {
-        // Output current state
         data = game.encode_state();
-        std::ofstream fout(file_state);
-        fout << data;
-        fout.close();
-        // Run external program
-        launch_executable(player_filename[game.cur_player]);
-        // Read action
-        std::ifstream fin(file_action);
         Point p(-1, -1);
-        while (true) {
-            int x, y;
-            if (!(fin >> x)) break;
-            if (!(fin >> y)) break;
-            p.x = x; p.y = y;
+        MoveTiming timing;
+#ifdef HAVE_POSIX
+        if (pipe_player[game.cur_player].pid >= 0) {
+            p = ask_player(pipe_player[game.cur_player], data, timing);
+        } else if (lib_player[game.cur_player].player) {
+            p = ask_library(lib_player[game.cur_player], data, timing);
+        } else
+#endif
+        {
+            // Output current state
+            state_written = true;
+            std::ofstream fout(file_state);
+            fout << data;
+            fout.close();
+            // Run external program
+            timing = launch_executable(player_filename[game.cur_player]);
+            // Read action
+            std::ifstream fin(file_action);
+            while (true) {
+                int x, y;
+                if (!(fin >> x)) break;
+                if (!(fin >> y)) break;
+                p.x = x; p.y = y;
+            }
+            fin.close();
+            // Reset action file
+            if (remove(file_action.c_str()) != 0)
+                std::cerr << "Error removing file: " << file_action << "\n";
         }
-        fin.close();
-        // Reset action file
-        if (remove(file_action.c_str()) != 0)
-            std::cerr << "Error removing file: " << file_action << "\n";
+        player_timing[game.cur_player].add(timing);
+        data = timing.encode();
+        std::cout << data;
+        log << data;
         // Take action
         if (!game.put_disc(p)) {
             // If action is invalid.
@@ -297,9 +722,31 @@ int main(int argc, char** argv) {
         std::cout << data;
         log << data;
     }
+    for (int i = 1; i <= 2; i++) {
+        data = std::string("Player ") + (i == OthelloBoard::BLACK ? "Black" : "White") + " time: " + \
+            player_timing[i].encode();
+        std::cout << data;
+        log << data;
+    }
     log.close();
+#ifdef HAVE_POSIX
+    for (int i = 1; i <= 2; i++) {
+        stop_player(pipe_player[i]);
+        unload_player(lib_player[i]);
+    }
+#endif
     // Reset state file
-    if (remove(file_state.c_str()) != 0)
+    if (state_written && remove(file_state.c_str()) != 0)
         std::cerr << "Error removing file: " << file_state << "\n";
+#ifdef HAVE_POSIX
+    // a hung player's thread may still be running in its library, which the
+    // exit handlers could take apart under it; the results are out already
+    for (int i = 1; i <= 2; i++) {
+        if (lib_player[i].hung) {
+            std::cout.flush();
+            std::_Exit(0);
+        }
+    }
+#endif
     return 0;
 }
@@ -6,11 +6,33 @@
 #include <sstream>
 #include <array>
 #include <vector>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <atomic>
+#include <thread>
+#include <cstring>
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define HAVE_MMAP 1
+#endif
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define HAVE_AVX2 1
+#endif
+
+#include "edge_table.h"
+#include "weights_format.h"
+#include "nnue.h"
 
 #define INF 0x3f3f3f3f
 using namespace std;
+// side the running search plays for, the evaluations are from its view. A
+// search sets it from the GameState it starts from, search_many for every
+// batch of leaves.
 int player;
 double best_choice = -INF;
 struct Point {
@@ -31,6 +53,307 @@ struct Point {
 	}
 };
 
+// zobrist keys of every (disc, square), the EMPTY row stays zero
+struct Zobrist {
+    unsigned long long piece[3][64];
+    unsigned long long side;
+    Zobrist(){
+        // splitmix64 with a fixed seed, the keys are the same in every run
+        unsigned long long seed = 0x9E3779B97F4A7C15ULL;
+        auto next = [&seed](){
+            unsigned long long z = (seed += 0x9E3779B97F4A7C15ULL);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        };
+        for(int i=0;i<64;i++){
+            piece[0][i] = 0;
+            piece[1][i] = next();
+            piece[2][i] = next();
+        }
+        side = next();
+    }
+};
+const Zobrist zobrist;
+
+// value of a disc on each square
+constexpr int price[8][8] = {
+    65,-5, 11, 8, 8, 11, -5, 65,
+   -5,-30, 4, 1, 1, 4, -30, -5,
+    11, 4, 5, 2, 2, 5, 4, 11,
+    8, 1, 3, 1, 1, 3, 1, 8,
+    8, 1, 3, 1, 1, 3, 1, 8,
+    11, 4, 5, 2, 2, 5, 4, 11,
+   -5, -30, 4, 1, 1, 4, -30, -5,
+    65,-5, 11, 8, 8, 11, -5, 65,
+};
+
+// bit x*8+y of a mask is the square (x,y)
+const unsigned long long ROW_0 = 0x00000000000000FFULL;
+const unsigned long long ROW_7 = 0xFF00000000000000ULL;
+const unsigned long long COL_0 = 0x0101010101010101ULL;
+const unsigned long long COL_7 = 0x8080808080808080ULL;
+const unsigned long long BORDER = ROW_0 | ROW_7 | COL_0 | COL_7;
+// every full line of the board in the four directions: rows, columns,
+// diagonals (x+1,y+1) and anti-diagonals (x+1,y-1)
+struct LineMasks {
+    unsigned long long lines[4][15];
+    int count[4];
+    LineMasks(){
+        const int dx[4] = {0,1,1,1}, dy[4] = {1,0,1,-1};
+        for(int d=0;d<4;d++){
+            count[d] = 0;
+            for(int sq=0;sq<64;sq++){
+                int x = sq / 8, y = sq % 8;
+                // start a line at squares without a predecessor
+                int px = x - dx[d], py = y - dy[d];
+                if(0 <= px && px < 8 && 0 <= py && py < 8){
+                    continue;
+                }
+                unsigned long long line = 0;
+                for(;0 <= x && x < 8 && 0 <= y && y < 8;x += dx[d],y += dy[d]){
+                    line |= 1ULL << (x*8+y);
+                }
+                lines[d][count[d]++] = line;
+            }
+        }
+    }
+};
+const LineMasks line_masks;
+
+// random playouts on bare bitboards, for the rollouts of the tree search
+// and playout_bench. Nothing is allocated: a game is two masks, the side
+// to move and the other, swapped after every move.
+struct Xorshift {
+    unsigned long long s;
+    explicit Xorshift(unsigned long long seed) : s(seed ? seed : 0x9E3779B97F4A7C15ULL) {}
+    unsigned long long next(){
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+};
+// the 8 directions as shifts of the square index, and the squares a shift
+// may land on without wrapping around a row
+const int PLAYOUT_SHIFT[8] = {1,-1,8,-8,9,-9,7,-7};
+const unsigned long long PLAYOUT_MASK[8] = {~COL_0,~COL_7,~0ULL,~0ULL,~COL_0,~COL_7,~COL_7,~COL_0};
+inline unsigned long long playout_shift(unsigned long long b , int d){
+    return (PLAYOUT_SHIFT[d] > 0 ? b << PLAYOUT_SHIFT[d] : b >> -PLAYOUT_SHIFT[d]) & PLAYOUT_MASK[d];
+}
+// empty squares where me flips something
+inline unsigned long long playout_moves(unsigned long long me , unsigned long long opp){
+    unsigned long long moves = 0, empty = ~(me | opp);
+    for(int d=0;d<8;d++){
+        unsigned long long x = playout_shift(me,d) & opp;
+        for(int i=0;i<5;i++){
+            x |= playout_shift(x,d) & opp;
+        }
+        moves |= playout_shift(x,d) & empty;
+    }
+    return moves;
+}
+// discs of opp that a disc of me on move turns
+inline unsigned long long playout_flips(unsigned long long me , unsigned long long opp , unsigned long long move){
+    unsigned long long flips = 0;
+    for(int d=0;d<8;d++){
+        unsigned long long line = 0, x = playout_shift(move,d);
+        while(x & opp){
+            line |= x;
+            x = playout_shift(x,d);
+        }
+        flips |= x & me ? line : 0;
+    }
+    return flips;
+}
+// plays random moves from me to move until the end, and returns the final
+// disc difference for me
+int playout(unsigned long long me , unsigned long long opp , Xorshift& rng){
+    int sign = 1;
+    bool passed = false;
+    for(;;){
+        unsigned long long moves = playout_moves(me,opp);
+        if(!moves){
+            if(passed){
+                break;
+            }
+            passed = true;
+        }
+        else{
+            passed = false;
+            // the k-th move of the mask
+            for(int k=rng.next() % __builtin_popcountll(moves);k>0;k--){
+                moves &= moves - 1;
+            }
+            unsigned long long move = moves & -moves;
+            unsigned long long flips = playout_flips(me,opp,move);
+            me |= move | flips;
+            opp &= ~flips;
+        }
+        std::swap(me,opp);
+        sign = -sign;
+    }
+    return sign * (__builtin_popcountll(me) - __builtin_popcountll(opp));
+}
+// n playouts, margins[i] of position (me[i], opp[i])
+void playouts(const unsigned long long* me , const unsigned long long* opp , int n , Xorshift& rng , int* margins){
+    for(int i=0;i<n;i++){
+        margins[i] = playout(me[i],opp[i],rng);
+    }
+}
+
+// fixed-point evaluation: scores are EVAL_SCALE times the old double ones
+const int EVAL_SCALE = 10;
+// phases of find_heuristic by the number of empties
+enum PHASE {
+    OPENING,    // more than 30 empties
+    MIDGAME,    // 20 to 30 empties
+    ENDGAME     // less than 20 empties
+};
+int game_phase(int empties){
+    return empties > 30 ? OPENING : empties < 20 ? ENDGAME : MIDGAME;
+}
+// weights of one phase in EVAL_SCALE units, stable and discs by the colour
+// we play. square already holds board * price for the inner 6x6 squares,
+// edge is board * 0.5 (the share of edge_table in the board value).
+struct PhaseWeights {
+    int square[64];
+    int edge;
+    int stable[3];
+    int motive;
+    int next_to_corner;
+    int discs[3];
+};
+constexpr PhaseWeights make_phase_weights(int board , int black_stable , int white_stable , int motive , \
+int next_to_corner , int black_discs , int white_discs){
+    PhaseWeights w{};
+    for(int sq=0;sq<64;sq++){
+        int x = sq / 8, y = sq % 8;
+        bool inner = 0 < x && x < 7 && 0 < y && y < 7;
+        w.square[sq] = inner ? board * price[x][y] : 0;
+    }
+    w.edge = board / 2;
+    w.stable[1] = black_stable;
+    w.stable[2] = white_stable;
+    w.motive = motive;
+    w.next_to_corner = next_to_corner;
+    w.discs[1] = black_discs;
+    w.discs[2] = white_discs;
+    return w;
+}
+// the opening started as its own terms plus the midgame ones, like the old
+// if/if-else chain in find_heuristic. tune rewrites this table.
+constexpr PhaseWeights phase_weights[3] = {
+    make_phase_weights(20,375,375,200,150,-35,-33),
+    make_phase_weights(10,125,125,100,75,0,0),
+    make_phase_weights(10,125,250,100,75,50,75)
+};
+
+// pattern evaluation: the board is cut into edge, corner, 2x5 block and
+// diagonal patterns, every pattern is read as a base 3 number (the disc on
+// each square is a digit, first square most significant) which indexes a
+// weight table of its type. The rotations/mirrors of a type share the table.
+enum PATTERN_TYPE {
+    EDGE_2X,      // an edge and its two X squares
+    CORNER_3X3,
+    BLOCK_2X5,
+    DIAG_8,
+    DIAG_7,
+    DIAG_6,
+    DIAG_5,
+    DIAG_4,
+    PATTERN_TYPES
+};
+const int PATTERN_INSTANCES = 34;
+const int PATTERN_PHASES = 6;
+// weights are stored as PATTERN_SCALE * value in a short
+const int PATTERN_SCALE = 8;
+struct PatternTables {
+    // squares of each instance, in digit order
+    int type[PATTERN_INSTANCES];
+    int size[PATTERN_INSTANCES];
+    int squares[PATTERN_INSTANCES][10];
+    // start of each type in a phase's weight table, entries of one phase
+    int offset[PATTERN_TYPES];
+    int entries;
+    // instances through every square and the power of 3 of its digit
+    int count[64];
+    int instance[64][8];
+    int pow3[64][8];
+    PatternTables(){
+        const int shapes[PATTERN_TYPES][11] = {
+            // size, then the squares as x*8+y
+            {10, 0,1,2,3,4,5,6,7, 9,14},
+            {9, 0,1,2,8,9,10,16,17,18},
+            {10, 0,1,2,3,4,8,9,10,11,12},
+            {8, 0,9,18,27,36,45,54,63},
+            {7, 1,10,19,28,37,46,55},
+            {6, 2,11,20,29,38,47},
+            {5, 3,12,21,30,39},
+            {4, 4,13,22,31}
+        };
+        // DIAG_8 is its own 180 degree rotation, BLOCK_2X5 also comes transposed
+        const int rotations[PATTERN_TYPES] = {4,4,4,2,4,4,4,4};
+        int n = 0;
+        entries = 0;
+        for(int t=0;t<PATTERN_TYPES;t++){
+            int sz = shapes[t][0];
+            offset[t] = entries;
+            int power = 1;
+            for(int i=0;i<sz;i++){
+                power *= 3;
+            }
+            entries += power;
+            for(int transpose=0;transpose<(t == BLOCK_2X5 ? 2 : 1);transpose++){
+                for(int r=0;r<rotations[t];r++){
+                    type[n] = t;
+                    size[n] = sz;
+                    for(int i=0;i<sz;i++){
+                        int x = shapes[t][i+1] / 8, y = shapes[t][i+1] % 8;
+                        if(transpose){
+                            std::swap(x,y);
+                        }
+                        for(int k=0;k<r;k++){
+                            int old_x = x;
+                            x = y;
+                            y = 7 - old_x;
+                        }
+                        squares[n][i] = x*8+y;
+                    }
+                    n++;
+                }
+            }
+        }
+        for(int sq=0;sq<64;sq++){
+            count[sq] = 0;
+        }
+        for(int i=0;i<PATTERN_INSTANCES;i++){
+            int power = 1;
+            for(int k=size[i]-1;k>=0;k--){
+                int sq = squares[i][k];
+                instance[sq][count[sq]] = i;
+                pow3[sq][count[sq]] = power;
+                count[sq]++;
+                power *= 3;
+            }
+        }
+    }
+};
+const PatternTables patterns;
+// [phase][entries] weights from black's point of view, in a mapped weights
+// file or in pattern_weights, null when the pattern evaluation is off
+const short* pattern_table = nullptr;
+std::vector<short> pattern_weights;
+// NNUE weights (nnue.h) in a mapped weights file, null unless the nnue
+// evaluator is on
+const short* nnue_w1 = nullptr;
+const short* nnue_b1 = nullptr;
+const signed char* nnue_w2 = nullptr;
+const int* nnue_b2 = nullptr;
+// game phase of a position by its number of empties
+int pattern_phase(int empties){
+    return std::min(PATTERN_PHASES - 1,(60 - empties) / 10);
+}
 
 class OthelloBoard {
 public: 
@@ -51,8 +374,16 @@ public:
     int cur_player;
     bool done;
     int winner;
-    double heuristic;
+    int heuristic;
     Point played_disc;
+    // zobrist hash of the discs, kept up to date by set_disc
+    unsigned long long hash;
+    // index of every pattern instance, kept up to date by set_disc
+    std::array<int, PATTERN_INSTANCES> pattern;
+    // mask of the squares holding each SPOT_STATE, kept up to date by set_disc
+    std::array<unsigned long long, 3> bits;
+    // NNUE first layer, kept up to date by set_disc while nnue_w1 is set
+    std::array<short, NNUE_HIDDEN> accumulator;
 private:
     int get_next_player(int player) const {
         return 3 - player;
@@ -64,6 +395,26 @@ private:
         return board[p.x][p.y];
     }
     void set_disc(Point p, int disc) {
+        int sq = p.x*SIZE+p.y;
+        hash ^= zobrist.piece[board[p.x][p.y]][sq] ^ zobrist.piece[disc][sq];
+        bits[board[p.x][p.y]] &= ~(1ULL << sq);
+        bits[disc] |= 1ULL << sq;
+        int diff = disc - board[p.x][p.y];
+        for(int k=0;k<patterns.count[sq];k++){
+            pattern[patterns.instance[sq][k]] += diff * patterns.pow3[sq][k];
+        }
+        if(nnue_w1){
+            if(board[p.x][p.y] != EMPTY){
+                const short* row = nnue_w1 + nnue_feature(board[p.x][p.y],sq) * NNUE_HIDDEN;
+                for(int i=0;i<NNUE_HIDDEN;i++){
+                    accumulator[i] -= row[i];
+                }
+            }
+            const short* row = nnue_w1 + nnue_feature(disc,sq) * NNUE_HIDDEN;
+            for(int i=0;i<NNUE_HIDDEN;i++){
+                accumulator[i] += row[i];
+            }
+        }
         board[p.x][p.y] = disc;
     }
     bool is_disc_at(Point p, int disc) const {
@@ -73,38 +424,45 @@ private:
             return false;
         return true;
     }
+    // move generation is instantiated for each side to move (Me), so the
+    // colour tests below are constants
+    template<int Me>
     bool is_spot_valid(Point center) const {
         if (get_disc(center) != EMPTY)
             return false;
         for (Point dir: directions) {
             // Move along the direction while testing.
             Point p = center + dir;
-            if (!is_disc_at(p, get_next_player(cur_player)))
+            if (!is_disc_at(p, 3 - Me))
                 continue;
             p = p + dir;
             while (is_spot_on_board(p) && get_disc(p) != EMPTY) {
-                if (is_disc_at(p, cur_player))
+                if (is_disc_at(p, Me))
                     return true;
                 p = p + dir;
             }
         }
         return false;
     }
+    bool is_spot_valid(Point center) const {
+        return cur_player == BLACK ? is_spot_valid<BLACK>(center) : is_spot_valid<WHITE>(center);
+    }
+    template<int Me>
     void flip_discs(Point center) {
         for (Point dir: directions) {
             // Move along the direction while testing.
             Point p = center + dir;
-            if (!is_disc_at(p, get_next_player(cur_player)))
+            if (!is_disc_at(p, 3 - Me))
                 continue;
             std::vector<Point> discs({p});
             p = p + dir;
             while (is_spot_on_board(p) && get_disc(p) != EMPTY) {
-                if (is_disc_at(p, cur_player)) {
+                if (is_disc_at(p, Me)) {
                     for (Point s: discs) {
-                        set_disc(s, cur_player);
+                        set_disc(s, Me);
                     }
-                    disc_count[cur_player] += discs.size();
-                    disc_count[get_next_player(cur_player)] -= discs.size();
+                    disc_count[Me] += discs.size();
+                    disc_count[3 - Me] -= discs.size();
                     break;
                 }
                 discs.push_back(p);
@@ -112,6 +470,53 @@ private:
             }
         }
     }
+    template<int Me>
+    std::vector<Point> valid_spots() const {
+        std::vector<Point> valid_spots;
+        for (int i = 0; i < SIZE; i++) {
+            for (int j = 0; j < SIZE; j++) {
+                Point p = Point(i, j);
+                if (board[i][j] != EMPTY)
+                    continue;
+                if (is_spot_valid<Me>(p))
+                    valid_spots.push_back(p);
+            }
+        }
+        return valid_spots;
+    }
+    // put_disc for Me to move, the opponent's instantiation takes over
+    // unless it has to pass
+    template<int Me>
+    bool play(Point p) {
+        if(!is_spot_valid<Me>(p)) {
+            cout << cur_player << " " << p.x << " " << p.y << endl;
+            winner = 3 - Me;
+            done = true;
+            return false;
+        }
+        set_disc(p, Me);
+        disc_count[Me]++;
+        disc_count[EMPTY]--;
+        flip_discs<Me>(p);
+        // Give control to the other player.
+        cur_player = 3 - Me;
+        next_valid_spots = valid_spots<3 - Me>();
+        // Check Win
+        if (next_valid_spots.size() == 0) {
+            cur_player = Me;
+            next_valid_spots = valid_spots<Me>();
+            if (next_valid_spots.size() == 0) {
+                // Game ends
+                done = true;
+                int white_discs = disc_count[WHITE];
+                int black_discs = disc_count[BLACK];
+                if (white_discs == black_discs) winner = EMPTY;
+                else if (black_discs > white_discs) winner = BLACK;
+                else winner = WHITE;
+            }
+        }
+        return true;
+    }
 public:
     OthelloBoard(const OthelloBoard& rhs) {
         for(int i=0;i<SIZE;i++){
@@ -130,6 +535,10 @@ public:
         heuristic = rhs.heuristic;
         winner = rhs.winner;
         played_disc = rhs.played_disc;
+        hash = rhs.hash;
+        pattern = rhs.pattern;
+        bits = rhs.bits;
+        accumulator = rhs.accumulator;
     }
     OthelloBoard() {
         reset();
@@ -138,6 +547,10 @@ public:
     const std::array<std::array<int, SIZE>, SIZE>&input_board, int player):board(input_board),\
     next_valid_spots(input_valid_point),cur_player(player){
         count_disc();
+        compute_hash();
+        compute_patterns();
+        compute_bits();
+        compute_accumulator();
         heuristic = 0;
         done = false;
         winner = -1;
@@ -155,52 +568,23 @@ public:
         disc_count[EMPTY] = 8*8-4;
         disc_count[BLACK] = 2;
         disc_count[WHITE] = 2;
+        compute_hash();
+        compute_patterns();
+        compute_bits();
+        compute_accumulator();
         next_valid_spots = get_valid_spots();
         done = false;
         winner = -1;
     }
     std::vector<Point> get_valid_spots() const {
-        std::vector<Point> valid_spots;
-        for (int i = 0; i < SIZE; i++) {
-            for (int j = 0; j < SIZE; j++) {
-                Point p = Point(i, j);
-                if (board[i][j] != EMPTY)
-                    continue;
-                if (is_spot_valid(p))
-                    valid_spots.push_back(p);
-            }
-        }
-        return valid_spots;
+        return cur_player == BLACK ? valid_spots<BLACK>() : valid_spots<WHITE>();
+    }
+    // number of moves side would have if it were to move
+    int mobility(int side) const {
+        return side == BLACK ? valid_spots<BLACK>().size() : valid_spots<WHITE>().size();
     }
     bool put_disc(Point p) {
-        if(!is_spot_valid(p)) {
-            cout << cur_player << " " << p.x << " " << p.y << endl;
-            winner = get_next_player(cur_player);
-            done = true;
-            return false;
-        }
-        set_disc(p, cur_player);
-        disc_count[cur_player]++;
-        disc_count[EMPTY]--;
-        flip_discs(p);
-        // Give control to the other player.
-        cur_player = get_next_player(cur_player);
-        next_valid_spots = get_valid_spots();
-        // Check Win
-        if (next_valid_spots.size() == 0) {
-            cur_player = get_next_player(cur_player);
-            next_valid_spots = get_valid_spots();
-            if (next_valid_spots.size() == 0) {
-                // Game ends
-                done = true;
-                int white_discs = disc_count[WHITE];
-                int black_discs = disc_count[BLACK];
-                if (white_discs == black_discs) winner = EMPTY;
-                else if (black_discs > white_discs) winner = BLACK;
-                else winner = WHITE;
-            }
-        }
-        return true;
+        return cur_player == BLACK ? play<BLACK>(p) : play<WHITE>(p);
     }
     void count_disc(){
         for(int i=0;i<3;i++){
@@ -212,144 +596,156 @@ public:
             }
         }
     }
-    int stability(const OthelloBoard& input , Point dir_1 , Point dir_2 , Point place){
-        int ans = 0;
-        if(input.board[place.x][place.y] == 0) return 0;
-        if(input.board[place.x][place.y] == player){
-            for(int i=0;i<8;i++){
-                if(input.board[place.x+dir_1.x*i][place.y+dir_1.y*i]!=player){
-                    break;
-                }
-                else{
-                    ans++;
-                }
-                if(i == 7 && input.board[place.x+dir_1.x*i][place.y+dir_1.y*i]==player) ans -= 4;
+    void compute_hash(){
+        hash = 0;
+        for(int i=0;i<SIZE;i++){
+            for(int j=0;j<SIZE;j++){
+                hash ^= zobrist.piece[board[i][j]][i*SIZE+j];
             }
-            for(int i=0;i<8;i++){
-                if(input.board[place.x+dir_2.x*i][place.y+dir_2.y*i]!=player){
-                    break;
-                }
-                else{
-                    ans++;
-                }
-                if(i == 7 && input.board[place.x+dir_2.x*i][place.y+dir_2.y*i]==player) ans -= 4;
+        }
+    }
+    void compute_patterns(){
+        for(int i=0;i<PATTERN_INSTANCES;i++){
+            pattern[i] = 0;
+            for(int k=0;k<patterns.size[i];k++){
+                int sq = patterns.squares[i][k];
+                pattern[i] = pattern[i] * 3 + board[sq / SIZE][sq % SIZE];
             }
-            return ans;
         }
-        else{
-            for(int i=0;i<8;i++){
-                if(input.board[place.x+dir_1.x*i][place.y+dir_1.y*i]!= 3-player){
-                    break;
-                }
-                else{
-                    ans++;
+    }
+    void compute_accumulator(){
+        accumulator.fill(0);
+        if(!nnue_w1){
+            return;
+        }
+        for(int i=0;i<NNUE_HIDDEN;i++){
+            accumulator[i] = nnue_b1[i];
+        }
+        for(int sq=0;sq<64;sq++){
+            int d = board[sq / SIZE][sq % SIZE];
+            if(d != EMPTY){
+                const short* row = nnue_w1 + nnue_feature(d,sq) * NNUE_HIDDEN;
+                for(int i=0;i<NNUE_HIDDEN;i++){
+                    accumulator[i] += row[i];
                 }
-                if(i == 7 && input.board[place.x+dir_1.x*i][place.y+dir_1.y*i]== 3-player) ans -= 4;
             }
-            for(int i=0;i<8;i++){
-                if(input.board[place.x+dir_2.x*i][place.y+dir_2.y*i]!= 3-player){
-                    break;
-                }
-                else{
-                    ans++;
+        }
+    }
+    void compute_bits(){
+        bits = {0,0,0};
+        for(int i=0;i<SIZE;i++){
+            for(int j=0;j<SIZE;j++){
+                bits[board[i][j]] |= 1ULL << (i*SIZE+j);
+            }
+        }
+    }
+    // the discs of each colour that can never be flipped. A disc is stable
+    // when in each of the four directions its line is full, or a neighbour
+    // on the line is the border or a stable disc of its own colour. Corners
+    // and full lines seed the set, which grows until nothing changes.
+    std::array<unsigned long long, 3> stable_discs() const {
+        unsigned long long filled = ~bits[EMPTY];
+        unsigned long long full[4];
+        for(int d=0;d<4;d++){
+            full[d] = 0;
+            for(int i=0;i<line_masks.count[d];i++){
+                if((line_masks.lines[d][i] & filled) == line_masks.lines[d][i]){
+                    full[d] |= line_masks.lines[d][i];
                 }
-                if(i == 7 && input.board[place.x+dir_2.x*i][place.y+dir_2.y*i]== 3-player) ans -= 4;
             }
-            return -ans;
         }
+        std::array<unsigned long long, 3> stable = {0,0,0};
+        for(int c=BLACK;c<=WHITE;c++){
+            unsigned long long s = 0, last;
+            do{
+                last = s;
+                unsigned long long row = full[0] | COL_0 | COL_7 | ((s >> 1) & ~COL_7) | ((s << 1) & ~COL_0);
+                unsigned long long col = full[1] | ROW_0 | ROW_7 | (s >> 8) | (s << 8);
+                unsigned long long diag = full[2] | BORDER | ((s >> 9) & ~COL_7) | ((s << 9) & ~COL_0);
+                unsigned long long anti = full[3] | BORDER | ((s >> 7) & ~COL_0) | ((s << 7) & ~COL_7);
+                s = bits[c] & row & col & diag & anti;
+            }while(s != last);
+            stable[c] = s;
+        }
+        return stable;
     }
-    double find_heuristic(OthelloBoard& input){
-        double heu = 0;
-        double price[8][8] = {
-            65,-5, 11, 8, 8, 11, -5, 65,
-           -5,-30, 4, 1, 1, 4, -30, -5,
-            11, 4, 5, 2, 2, 5, 4, 11,
-            8, 1, 3, 1, 1, 3, 1, 8,
-            8, 1, 3, 1, 1, 3, 1, 8,
-            11, 4, 5, 2, 2, 5, 4, 11,
-           -5, -30, 4, 1, 1, 4, -30, -5,
-            65,-5, 11, 8, 8, 11, -5, 65,
-        };
-        double board_value = 0, motive = 0;
-        double stable = 0;
-        // p ->piece difference 
+    // edge_table value of the four edges for Me
+    template<int Me>
+    int edge_value() const {
+        int top = 0, bottom = 0, left = 0, right = 0;
         for(int i=0;i<SIZE;i++){
-            for(int j=0;j<SIZE;j++){
-                if(input.board[i][j] == player){
-                    board_value += price[i][j];
+            top = top * 3 + board[0][i];
+            bottom = bottom * 3 + board[7][i];
+            left = left * 3 + board[i][0];
+            right = right * 3 + board[i][7];
+        }
+        const short* table = edge_table[cur_player - 1];
+        int sum = table[top] + table[bottom] + table[left] + table[right];
+        return Me == BLACK ? sum : -sum;
+    }
+    // sum of the pattern weights of the current phase, from player's side
+    int pattern_heuristic() const {
+        const short* w = pattern_table + pattern_phase(disc_count[EMPTY]) * patterns.entries;
+        int sum = 0;
+        for(int i=0;i<PATTERN_INSTANCES;i++){
+            sum += w[patterns.offset[patterns.type[i]] + pattern[i]];
+        }
+        return (player == BLACK ? sum : -sum) * EVAL_SCALE / PATTERN_SCALE;
+    }
+    // position key including the side to move
+    unsigned long long key() const {
+        return cur_player == WHITE ? hash ^ zobrist.side : hash;
+    }
+    // evaluation of one phase for Me (always player), the weights and the
+    // colour tests are resolved at compile time
+    template<int Phase, int Me>
+    int evaluate(OthelloBoard& input){
+        const PhaseWeights& w = phase_weights[Phase];
+        // the weights that differ between the colours
+        constexpr int stable_weight = phase_weights[Phase].stable[Me];
+        constexpr int disc_weight = phase_weights[Phase].discs[Me];
+        int board_value = 0;
+        int stable = 0;
+        // p ->piece difference, the edges come from edge_table
+        for(int i=1;i<SIZE-1;i++){
+            for(int j=1;j<SIZE-1;j++){
+                if(input.board[i][j] == Me){
+                    board_value += w.square[i*SIZE+j];
                 }
-                else if(input.board[i][j] == 3- player){
-                    board_value -= price[i][j];
+                else if(input.board[i][j] == 3 - Me){
+                    board_value -= w.square[i*SIZE+j];
                 }
             }
         }
-        input.cur_player = get_next_player(input.cur_player);
-        std::vector<Point> temp  = get_valid_spots();
-        motive -= temp.size();
-        input.cur_player = get_next_player(input.cur_player);
-        motive = input.next_valid_spots.size();
-        Point a(1,0),b(0,1),c(0,0);
-        stable += stability(input,a,b,c);
-        Point a_1(-1,0),b_1(0,1),c_1(7,0);
-        stable += stability(input,a_1,b_1,c_1);
-        Point a_2(1,0),b_2(0,-1),c_2(0,7);
-        stable += stability(input,a_2,b_2,c_2);
-        Point a_3(-1,0),b_3(0,-1),c_3(7,7);
-        stable += stability(input,a_3,b_3,c_3);
+        board_value += w.edge * input.edge_value<Me>();
+        // mobility of the side to move
+        int motive = input.next_valid_spots.size();
+        std::array<unsigned long long, 3> stable_set = input.stable_discs();
+        stable = __builtin_popcountll(stable_set[Me]) - __builtin_popcountll(stable_set[3 - Me]);
+        // X squares next to an empty corner, the C squares are in the edges
         int next_to_corner = 0;
-        if(input.board[0][0] == 0)   {
-		    if(input.board[0][1] == player) next_to_corner--;
-		    else if(input.board[0][1] == 3 - player) next_to_corner++;
-		    if(input.board[1][1] == player) next_to_corner--;
-		    else if(input.board[1][1] == 3 - player) next_to_corner++;
-		    if(input.board[1][0] == player) next_to_corner--;
-		    else if(input.board[1][0] == 3 - player) next_to_corner++;
-	    }
-	    if(input.board[0][7] == 0)   {
-		    if(input.board[0][6] == player) next_to_corner--;
-		    else if(input.board[0][6] == 3 - player) next_to_corner++;
-		    if(input.board[1][6] == player) next_to_corner--;
-		    else if(input.board[1][6] == 3 - player) next_to_corner++;
-		    if(input.board[1][7] == player) next_to_corner--;
-		    else if(input.board[1][7] == 3 - player) next_to_corner++;
-	    }
-	    if(input.board[7][0] == 0)   {
-		    if(input.board[7][1] == player) next_to_corner--;
-		    else if(input.board[7][1] == 3 - player) next_to_corner++;
-		    if(input.board[6][1] == player) next_to_corner--;
-		    else if(input.board[6][1] == 3 - player) next_to_corner++;
-		    if(input.board[6][0] == player) next_to_corner--;
-		    else if(input.board[6][0] == 3 - player) next_to_corner++;
-	    }
-	    if(input.board[7][7] == 0)   {
-		    if(input.board[6][7] == player) next_to_corner--;
-		    else if(input.board[6][7] == 3 - player) next_to_corner++;
-		    if(input.board[6][6] == player) next_to_corner--;
-		    else if(input.board[6][6] == 3 - player) next_to_corner++;
-		    if(input.board[7][6] == player) next_to_corner--;
-		    else if(input.board[7][6] == 3 - player) next_to_corner++;
-	    }
-        /*if(input.board[0][0] == 3- player || input.board[7][0] == 3- player ||
-        input.board[0][7] == 3- player || input.board[7][7] == 3- player ){
-            heu -= 5000;
-        }*/
-        if(disc_count[0] > 30){
-            if(player == 1)
-                heu += 1*board_value + 25*stable + 10*motive + 7.5*next_to_corner - 3.5*(disc_count[player]-disc_count[3-player]);
-            else
-                heu += 1*board_value + 25*stable + 10*motive + 7.5*next_to_corner - 3.3*(disc_count[player]-disc_count[3-player]);
-        }
-        if(disc_count[0] < 20){
-            if(player == 1)
-                heu += 1*board_value + 12.5*stable + 10*motive + 7.5*next_to_corner + 5*(disc_count[player]-disc_count[3-player]);
-            else{
-                heu += 1*board_value + 25*stable + 10*motive + 7.5*next_to_corner + 7.5*(disc_count[player]-disc_count[3-player]);
+        const int corner[4][2] = {{0,0},{0,7},{7,0},{7,7}};
+        for(int k=0;k<4;k++){
+            int x = corner[k][0], y = corner[k][1];
+            if(input.board[x][y] == EMPTY){
+                int diagonal = input.board[x == 0 ? 1 : 6][y == 0 ? 1 : 6];
+                if(diagonal == Me) next_to_corner--;
+                else if(diagonal == 3 - Me) next_to_corner++;
             }
         }
-
-        else
-            heu += 1*board_value + 12.5*stable + 10*motive + 7.5*next_to_corner ;
-        return heu;
+        return board_value + stable_weight*stable + w.motive*motive + w.next_to_corner*next_to_corner + \
+        disc_weight*(disc_count[Me]-disc_count[3-Me]);
+    }
+    template<int Me>
+    int find_heuristic(OthelloBoard& input){
+        switch(game_phase(disc_count[EMPTY])){
+            case OPENING: return evaluate<OPENING,Me>(input);
+            case MIDGAME: return evaluate<MIDGAME,Me>(input);
+            default: return evaluate<ENDGAME,Me>(input);
+        }
+    }
+    int find_heuristic(OthelloBoard& input){
+        return player == BLACK ? find_heuristic<BLACK>(input) : find_heuristic<WHITE>(input);
     }
     
     OthelloBoard& operator=(const OthelloBoard& rhs){
@@ -358,9 +754,7 @@ public:
             board[i][j] = rhs.board[i][j];
         }
     }
-    for(long unsigned int i=0;i<rhs.next_valid_spots.size();i++){
-        next_valid_spots.push_back(rhs.next_valid_spots[i]);
-    }
+    next_valid_spots = rhs.next_valid_spots;
     for(int i=0;i<3;i++){
         disc_count[i] = rhs.disc_count[i];
     }
@@ -369,6 +763,10 @@ public:
     heuristic = rhs.heuristic;
     winner = rhs.winner;
     played_disc = rhs.played_disc;
+    hash = rhs.hash;
+    pattern = rhs.pattern;
+    bits = rhs.bits;
+    accumulator = rhs.accumulator;
     return *this;
     }
 };
@@ -376,119 +774,2081 @@ public:
 
 
 const int SIZE = 8;
-std::array<std::array<int, SIZE>, SIZE> board;
-std::vector<Point> next_valid_spots;
+// the content of a state file: the side to move, the board and its moves
+struct GameState {
+    int player;
+    std::array<std::array<int, SIZE>, SIZE> board;
+    std::vector<Point> next_valid_spots;
+};
 
-void read_board(std::ifstream& fin) {
-    fin >> player;
+void read_board(std::istream& fin , GameState& state) {
+    fin >> state.player;
     for (int i = 0; i < SIZE; i++) {
         for (int j = 0; j < SIZE; j++) {
-            fin >> board[i][j];
+            fin >> state.board[i][j];
         }
     }
 }
 
-void read_valid_spots(std::ifstream& fin) {
+void read_valid_spots(std::istream& fin , GameState& state) {
     int n_valid_spots;
     fin >> n_valid_spots;
     int x, y;
+    state.next_valid_spots.clear();
     for (int i = 0; i < n_valid_spots; i++) {
         fin >> x >> y;
-        next_valid_spots.push_back({x, y});
+        state.next_valid_spots.push_back({x, y});
     }
 }
-int count = 0;
-OthelloBoard update(const OthelloBoard& in,Point place){
-    count++;
+// search log, moved to stderr when stdout carries the moves
+std::ostream* info = &cout;
+// every put_disc made by the search counts as one node
+long long nodes = 0;
+// node budget of a deterministic search, 0 means search to a fixed depth
+long long node_limit = 0;
+// set from outside to abort the running search (end of pondering)
+std::atomic<bool> stop_search(false);
+// set by the engine for a search that has to finish after a stop (the
+// fallback of a stopped solve). stop_search belongs to whoever stops the
+// search and is left as it is.
+bool stop_ignored = false;
+bool search_stopped(){
+    return (stop_search && !stop_ignored) || (node_limit > 0 && nodes >= node_limit);
+}
+// evaluation cache: heuristics of recently evaluated positions, direct
+// mapped by key. It is independent of the transposition table and lives
+// for the whole process, the entry remembers whose side the value is from.
+struct EvalEntry {
+    unsigned long long key;
+    int value;
+    int player;
+};
+std::vector<EvalEntry> eval_cache;
+unsigned long long eval_mask = 0;
+long long eval_probes = 0, eval_hits = 0;
+// MY_PROJECT_EVAL_CACHE=<bits> sizes the cache to 2^bits entries (16 by
+// default), 0 turns it off
+void eval_cache_init(){
+    const char* bits = getenv("MY_PROJECT_EVAL_CACHE");
+    int n = bits ? std::max(0,std::min(28,atoi(bits))) : 16;
+    if(n > 0){
+        eval_cache.assign(1ULL << n,EvalEntry{0,0,0});
+        eval_mask = eval_cache.size() - 1;
+    }
+}
+bool eval_cache_probe(unsigned long long key , int& value){
+    if(eval_cache.empty()){
+        return false;
+    }
+    EvalEntry& e = eval_cache[key & eval_mask];
+    eval_probes++;
+    if(e.key == key && e.player == player){
+        eval_hits++;
+        value = e.value;
+        return true;
+    }
+    return false;
+}
+void eval_cache_store(unsigned long long key , int value){
+    if(!eval_cache.empty()){
+        eval_cache[key & eval_mask] = EvalEntry{key,value,player};
+    }
+}
+template<class Eval>
+int cached_evaluate(OthelloBoard& board){
+    int value;
+    if(!eval_cache_probe(board.key(),value)){
+        value = Eval::evaluate(board);
+        eval_cache_store(board.key(),value);
+    }
+    return value;
+}
+// info evalcache probes <p> hits <h> rate <percent>
+void print_eval_cache(){
+    if(eval_probes > 0){
+        *info << "info evalcache probes " << eval_probes << " hits " << eval_hits << \
+        " rate " << 100 * eval_hits / eval_probes << endl;
+    }
+}
+// the board after place, not evaluated yet
+OthelloBoard play_move(const OthelloBoard& in,Point place){
+    nodes++;
     OthelloBoard create(in);
     create.put_disc(place);
     create.played_disc = place;
-    create.heuristic = create.find_heuristic(create);
     return create;
 }
-// state 1 -> find max / state 0 ->find min
-double search(OthelloBoard& board , double& player_strategy , double& opponent_strategy , int depth , int state){
-    if(board.done || depth == 0){
-        
-        if(board.winner == 3 - player){
-            return -INF + 100;
+template<class Eval>
+OthelloBoard update(const OthelloBoard& in,Point place){
+    OthelloBoard create = play_move(in,place);
+    create.heuristic = cached_evaluate<Eval>(create);
+    return create;
+}
+// batch evaluation of the children of one node. They share the phase (all
+// have one empty less than the parent) and the player, so find_heuristic's
+// terms can be computed for BATCH_LANES boards at once: the piece-square sum
+// and the X-square term from the bitboards, one board per 32 bit lane, the
+// table driven terms (edges, stable discs, mobility) per board beforehand.
+const int BATCH_LANES = 8;
+struct SiblingBatch {
+    // bitboards of player and of the opponent, split in 32 bit halves
+    alignas(32) unsigned int me_lo[BATCH_LANES], me_hi[BATCH_LANES];
+    alignas(32) unsigned int opp_lo[BATCH_LANES], opp_hi[BATCH_LANES];
+    alignas(32) int edge[BATCH_LANES], stable[BATCH_LANES], motive[BATCH_LANES], discs[BATCH_LANES];
+    alignas(32) int score[BATCH_LANES];
+};
+template<int Me>
+void batch_fill(SiblingBatch& b , int lane , const OthelloBoard& c){
+    b.me_lo[lane] = (unsigned int)c.bits[Me];
+    b.me_hi[lane] = (unsigned int)(c.bits[Me] >> 32);
+    b.opp_lo[lane] = (unsigned int)c.bits[3 - Me];
+    b.opp_hi[lane] = (unsigned int)(c.bits[3 - Me] >> 32);
+    b.edge[lane] = c.edge_value<Me>();
+    std::array<unsigned long long, 3> stable_set = c.stable_discs();
+    b.stable[lane] = __builtin_popcountll(stable_set[Me]) - __builtin_popcountll(stable_set[3 - Me]);
+    b.motive[lane] = c.next_valid_spots.size();
+    b.discs[lane] = c.disc_count[Me] - c.disc_count[3 - Me];
+}
+// corners and their X squares
+const int batch_corner[4][2] = {{0,9},{7,14},{56,49},{63,54}};
+void batch_scores_scalar(SiblingBatch& b , const PhaseWeights& w , int stable_weight , int disc_weight){
+    for(int lane=0;lane<BATCH_LANES;lane++){
+        unsigned long long me = b.me_lo[lane] | (unsigned long long)b.me_hi[lane] << 32;
+        unsigned long long opp = b.opp_lo[lane] | (unsigned long long)b.opp_hi[lane] << 32;
+        int sum = 0, next_to_corner = 0;
+        for(int sq=0;sq<64;sq++){
+            sum += (int)((me >> sq) & 1) * w.square[sq] - (int)((opp >> sq) & 1) * w.square[sq];
         }
-        else if(board.winner == player){
-            return INF;
+        for(int k=0;k<4;k++){
+            if(!(((me | opp) >> batch_corner[k][0]) & 1)){
+                next_to_corner += (int)((opp >> batch_corner[k][1]) & 1) - (int)((me >> batch_corner[k][1]) & 1);
+            }
         }
-        return board.heuristic;
+        b.score[lane] = sum + w.edge*b.edge[lane] + stable_weight*b.stable[lane] + w.motive*b.motive[lane] + \
+        w.next_to_corner*next_to_corner + disc_weight*b.discs[lane];
     }
-    int k = depth;
-    k--;
-    if(state == 1){
-        double val = -INF;
-        for(auto it:board.next_valid_spots){
-            OthelloBoard next = board;
-            next.put_disc(it);
-            next.heuristic = next.find_heuristic(next);
-            double value = search(next,player_strategy,opponent_strategy,k,0);
-            val = max(val,value);
-            if(val > player_strategy){
-                player_strategy = val;
-            }
-            if(player_strategy >= opponent_strategy){
-                break;
+}
+#ifdef HAVE_AVX2
+// all ones in the lanes whose bit sq is set
+__attribute__((target("avx2")))
+inline __m256i batch_bit(__m256i v , int sq){
+    return _mm256_srai_epi32(_mm256_sll_epi32(v,_mm_cvtsi32_si128(31 - sq)),31);
+}
+__attribute__((target("avx2")))
+void batch_scores_avx2(SiblingBatch& b , const PhaseWeights& w , int stable_weight , int disc_weight){
+    const __m256i half[2][2] = {
+        {_mm256_load_si256((const __m256i*)b.me_lo),_mm256_load_si256((const __m256i*)b.opp_lo)},
+        {_mm256_load_si256((const __m256i*)b.me_hi),_mm256_load_si256((const __m256i*)b.opp_hi)}
+    };
+    __m256i sum = _mm256_setzero_si256();
+    for(int sq=0;sq<64;sq++){
+        if(w.square[sq] == 0){
+            continue;
+        }
+        __m256i weight = _mm256_set1_epi32(w.square[sq]);
+        sum = _mm256_add_epi32(sum,_mm256_and_si256(batch_bit(half[sq / 32][0],sq % 32),weight));
+        sum = _mm256_sub_epi32(sum,_mm256_and_si256(batch_bit(half[sq / 32][1],sq % 32),weight));
+    }
+    // the masks are -1 where set, so an opponent's X square adds one
+    __m256i next_to_corner = _mm256_setzero_si256();
+    for(int k=0;k<4;k++){
+        int corner = batch_corner[k][0], x = batch_corner[k][1];
+        const __m256i* h = half[corner / 32];
+        __m256i empty = _mm256_andnot_si256(_mm256_or_si256(batch_bit(h[0],corner % 32),batch_bit(h[1],corner % 32)),_mm256_set1_epi32(-1));
+        next_to_corner = _mm256_add_epi32(next_to_corner,_mm256_and_si256(empty,batch_bit(h[0],x % 32)));
+        next_to_corner = _mm256_sub_epi32(next_to_corner,_mm256_and_si256(empty,batch_bit(h[1],x % 32)));
+    }
+    sum = _mm256_add_epi32(sum,_mm256_mullo_epi32(next_to_corner,_mm256_set1_epi32(w.next_to_corner)));
+    const int* terms[4] = {b.edge,b.stable,b.motive,b.discs};
+    const int weights[4] = {w.edge,stable_weight,w.motive,disc_weight};
+    for(int t=0;t<4;t++){
+        __m256i v = _mm256_load_si256((const __m256i*)terms[t]);
+        sum = _mm256_add_epi32(sum,_mm256_mullo_epi32(v,_mm256_set1_epi32(weights[t])));
+    }
+    _mm256_store_si256((__m256i*)b.score,sum);
+}
+const bool have_avx2 = __builtin_cpu_supports("avx2");
+#endif
+void batch_scores(SiblingBatch& b , const PhaseWeights& w , int stable_weight , int disc_weight){
+#ifdef HAVE_AVX2
+    if(have_avx2){
+        batch_scores_avx2(b,w,stable_weight,disc_weight);
+        return;
+    }
+#endif
+    batch_scores_scalar(b,w,stable_weight,disc_weight);
+}
+// find_heuristic of every board, the boards have the same empties
+void evaluate_phase_batch(const std::vector<OthelloBoard*>& misses){
+    for(size_t first=0;first<misses.size();first+=BATCH_LANES){
+        int lanes = std::min((int)(misses.size() - first),BATCH_LANES);
+        SiblingBatch b = SiblingBatch();
+        for(int lane=0;lane<lanes;lane++){
+            if(player == OthelloBoard::BLACK){
+                batch_fill<OthelloBoard::BLACK>(b,lane,*misses[first + lane]);
+            }
+            else{
+                batch_fill<OthelloBoard::WHITE>(b,lane,*misses[first + lane]);
             }
         }
-        return val;
+        const PhaseWeights& w = phase_weights[game_phase(misses[first]->disc_count[OthelloBoard::EMPTY])];
+        batch_scores(b,w,w.stable[player],w.discs[player]);
+        for(int lane=0;lane<lanes;lane++){
+            misses[first + lane]->heuristic = b.score[lane];
+        }
     }
-    else if(state == 0){
-        double val = INF;
-        for(auto it:board.next_valid_spots){
-            OthelloBoard next = board;
-            next.put_disc(it);
-            next.heuristic = next.find_heuristic(next);
-            double value = search(next,player_strategy,opponent_strategy,k,1);
-            val = min(val,value);
-            if(val < opponent_strategy){
-                opponent_strategy = val;
-            }
-            if(player_strategy >= opponent_strategy){
-                //cout << "cutoff" << endl;
-                break;
+}
+// find_heuristic of every board. The lanes of a batch share the phase
+// weights, so boards of different phases (the leaves of different games in
+// search_many) are batched phase by phase.
+void evaluate_batch(const std::vector<OthelloBoard*>& boards){
+    const int phase = boards.empty() ? 0 : game_phase(boards[0]->disc_count[OthelloBoard::EMPTY]);
+    bool mixed = false;
+    for(auto b:boards){
+        mixed = mixed || game_phase(b->disc_count[OthelloBoard::EMPTY]) != phase;
+    }
+    if(!mixed){
+        evaluate_phase_batch(boards);
+        return;
+    }
+    std::vector<OthelloBoard*> by_phase[3];
+    for(auto b:boards){
+        by_phase[game_phase(b->disc_count[OthelloBoard::EMPTY])].push_back(b);
+    }
+    for(auto& group:by_phase){
+        evaluate_phase_batch(group);
+    }
+}
+// heuristic of every child, the same values update() would give them
+template<class Eval>
+void evaluate_children(std::vector<OthelloBoard>& children){
+    std::vector<OthelloBoard*> misses;
+    for(auto& c:children){
+        if(!eval_cache_probe(c.key(),c.heuristic)){
+            misses.push_back(&c);
+        }
+    }
+    Eval::evaluate_all(misses);
+    for(auto c:misses){
+        eval_cache_store(c->key(),c->heuristic);
+    }
+}
+// price of a square averaged over the 8 symmetries of the board. price
+// isn't quite symmetric ((2,3) is 2, (3,2) is 3) and the instances of a
+// pattern share one table, so this is the table the patterns can reproduce.
+double symmetric_price(int sq){
+    double sum = 0;
+    for(int transpose=0;transpose<2;transpose++){
+        for(int r=0;r<4;r++){
+            int x = sq / 8, y = sq % 8;
+            if(transpose){
+                std::swap(x,y);
             }
+            for(int k=0;k<r;k++){
+                int old_x = x;
+                x = y;
+                y = 7 - old_x;
+            }
+            sum += price[x][y];
         }
-        return val;
     }
-    return -1;
+    return sum / 8;
 }
-// player 1 -> x  // player 2 -> o
-void write_valid_spot(std::ofstream& fout) {
-    OthelloBoard cur(next_valid_spots,board,player);
-    double max = -INF;
-    double min = INF;
-    double desicion = -INF;
-    for(auto it:cur.next_valid_spots){
-        double val;
-        OthelloBoard new_one;
-        new_one = cur;
-        new_one.put_disc(it);
-        new_one.heuristic = new_one.find_heuristic(new_one);
-        val = search(new_one,max,min,5,0);
-        cout << "current val " << val ;
-        if(val > desicion){
-            desicion = val;
-            cur.played_disc = it;
-        }
-    }
-    cout << endl;
-    cout << cur.played_disc.x << " " << cur.played_disc.y << std::endl;
-    fout << cur.played_disc.x << " " << cur.played_disc.y << std::endl;
-    fout.flush();
+// weights that reproduce symmetric_price: every pattern instance gets its
+// squares' share of the price of the discs on them. The price table has no
+// phases, so every phase starts with the same weights; they only differ
+// once a trained weights file is loaded (MY_PROJECT_PATTERNS).
+void pattern_builtin_weights(){
+    int cover[64] = {0};
+    for(int i=0;i<PATTERN_INSTANCES;i++){
+        for(int k=0;k<patterns.size[i];k++){
+            cover[patterns.squares[i][k]]++;
+        }
+    }
+    double share[64];
+    for(int sq=0;sq<64;sq++){
+        share[sq] = symmetric_price(sq) / cover[sq];
+    }
+    pattern_weights.assign(PATTERN_PHASES * patterns.entries,0);
+    int first = 0;
+    for(int t=0;t<PATTERN_TYPES;t++){
+        while(patterns.type[first] != t){
+            first++;
+        }
+        const int* squares = patterns.squares[first];
+        int sz = patterns.size[first];
+        int total = t + 1 < PATTERN_TYPES ? patterns.offset[t+1] - patterns.offset[t] : patterns.entries - patterns.offset[t];
+        for(int idx=0;idx<total;idx++){
+            double value = 0;
+            int rest = idx;
+            for(int k=sz-1;k>=0;k--){
+                int d = rest % 3, sq = squares[k];
+                rest /= 3;
+                if(d != OthelloBoard::EMPTY){
+                    value += (d == OthelloBoard::BLACK ? 1 : -1) * share[sq];
+                }
+            }
+            for(int ph=0;ph<PATTERN_PHASES;ph++){
+                pattern_weights[ph * patterns.entries + patterns.offset[t] + idx] = (short)lround(value * PATTERN_SCALE);
+            }
+        }
+    }
 }
-
-int main(int, char** argv) {
-    std::ifstream fin(argv[1]);
-    std::ofstream fout(argv[2]);
-    read_board(fin);
-    read_valid_spots(fin);
-    write_valid_spot(fout);
-    fin.close();
-    fout.close();
-    return 0;
-}
\ No newline at end of file
+// a weights file (weights_format.h) mapped read-only: the pages are shared
+// through the page cache by every process using the file, so nothing is
+// read or copied at startup
+struct MappedWeights {
+    const void* base;
+    unsigned long long bytes;
+    // the file's contents where it can't be mapped
+    std::vector<unsigned long long> copy;
+};
+bool weights_map(const char* path , MappedWeights& w){
+    w.base = nullptr;
+    w.bytes = 0;
+#ifdef HAVE_MMAP
+    int fd = open(path,O_RDONLY);
+    if(fd < 0){
+        return false;
+    }
+    struct stat st;
+    if(fstat(fd,&st) != 0 || st.st_size <= 0){
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr,st.st_size,PROT_READ,MAP_SHARED,fd,0);
+    close(fd);
+    if(map == MAP_FAILED){
+        return false;
+    }
+    w.base = map;
+    w.bytes = st.st_size;
+#else
+    std::ifstream in(path,std::ios::binary | std::ios::ate);
+    if(!in){
+        return false;
+    }
+    w.bytes = in.tellg();
+    w.copy.assign((w.bytes + 7) / 8,0);
+    in.seekg(0);
+    if(!in.read(reinterpret_cast<char*>(w.copy.data()),w.bytes)){
+        return false;
+    }
+    w.base = w.copy.data();
+#endif
+    return true;
+}
+MappedWeights pattern_file;
+// MY_PROJECT_PATTERNS=<file> maps the pattern weights from the "patterns"
+// section (i16, [phase][entry]) of a weights file. MY_PROJECT_PATTERNS=builtin
+// or no file uses pattern_builtin_weights.
+void pattern_init(){
+    const char* path = getenv("MY_PROJECT_PATTERNS");
+    if(path && std::string(path) != "builtin"){
+        if(weights_map(path,pattern_file)){
+            pattern_table = static_cast<const short*>(weights_find(pattern_file.base,pattern_file.bytes,"patterns",\
+            WEIGHT_I16,PATTERN_PHASES * patterns.entries));
+        }
+        if(pattern_table){
+            return;
+        }
+        cerr << "can't use pattern weights " << path << ", using the builtin ones" << endl;
+    }
+    pattern_builtin_weights();
+    pattern_table = pattern_weights.data();
+}
+// evaluator policies. The search is instantiated for each one, so their
+// evaluate inlines into it. evaluate scores a board for player in
+// EVAL_SCALE units, evaluate_all sets the heuristic of boards with the
+// same empties. Besides this file's own evaluations the heuristics of the
+// other players in this directory are ported as they are, with their
+// doubles scaled by EVAL_SCALE.
+template<class Eval>
+void evaluate_each(const std::vector<OthelloBoard*>& boards){
+    for(auto b:boards){
+        b->heuristic = Eval::evaluate(*b);
+    }
+}
+struct PhaseEval {
+    static int evaluate(OthelloBoard& b){
+        return b.find_heuristic(b);
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_batch(boards);
+    }
+};
+struct PatternEval {
+    static int evaluate(OthelloBoard& b){
+        return b.pattern_heuristic();
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<PatternEval>(boards);
+    }
+};
+// squares next to a square of b in any of the 8 directions
+unsigned long long neighbours(unsigned long long b){
+    unsigned long long left = (b >> 1) & ~COL_7, right = (b << 1) & ~COL_0;
+    unsigned long long row = b | left | right;
+    return left | right | (row >> 8) | (row << 8);
+}
+// 100 * (mine - theirs) / (mine + theirs) with the sign of the larger one,
+// the share formula of pass_three.cpp
+double share(double mine , double theirs){
+    if(mine > theirs){
+        return mine * 100 / (mine + theirs);
+    }
+    else if(mine < theirs){
+        return -theirs * 100 / (mine + theirs);
+    }
+    return 0;
+}
+// corner occupation and corner closeness of pass_three.cpp and temp.cpp
+void corner_terms(const OthelloBoard& input , double& c , double& l){
+    const int corner[4][2] = {{0,0},{0,7},{7,0},{7,7}};
+    int my_tiles = 0, opp_tiles = 0, my_close = 0, opp_close = 0;
+    for(int k=0;k<4;k++){
+        int x = corner[k][0], y = corner[k][1];
+        if(input.board[x][y] == player) my_tiles++;
+        else if(input.board[x][y] == 3 - player) opp_tiles++;
+        if(input.board[x][y] == 0){
+            int dx = x == 0 ? 1 : -1, dy = y == 0 ? 1 : -1;
+            const int close[3][2] = {{x,y + dy},{x + dx,y + dy},{x + dx,y}};
+            for(int n=0;n<3;n++){
+                int d = input.board[close[n][0]][close[n][1]];
+                if(d == player) my_close++;
+                else if(d == 3 - player) opp_close++;
+            }
+        }
+    }
+    c = 25 * (my_tiles - opp_tiles);
+    l = -12.5 * (my_close - opp_close);
+}
+// pass_three.cpp: disc share, corners, mobility share, frontier and
+// potential mobility from bitboards, piece-square values
+struct PassThreeEval {
+    static int evaluate(OthelloBoard& input){
+        static const double price[8][8] = {
+             20, -3, 11, 8, 8, 11, -3, 20,
+            -3, -7, -4, 1, 1, -4, -7, -3,
+             11, -4, 2, 2, 2, 2, -4, 11,
+             8, 1, 2, -3, -3, 2, 1, 8,
+             8, 1, 2, -3, -3, 2, 1, 8,
+             11, -4, 2, 2, 2, 2, -4, 11,
+            -3, -7, -4, 1, 1, -4, -7, -3,
+             20, -3, 11, 8, 8, 11, -3, 20,
+        };
+        unsigned long long mine = input.bits[player], opp = input.bits[3 - player];
+        unsigned long long empty = input.bits[OthelloBoard::EMPTY];
+        double d = 0;
+        for(int sq=0;sq<64;sq++){
+            if((mine >> sq) & 1) d += price[sq / 8][sq % 8];
+            else if((opp >> sq) & 1) d -= price[sq / 8][sq % 8];
+        }
+        double p = share(__builtin_popcountll(mine),__builtin_popcountll(opp));
+        double f = -share(__builtin_popcountll(mine & neighbours(empty)),__builtin_popcountll(opp & neighbours(empty)));
+        int my_potential = __builtin_popcountll(empty & neighbours(opp));
+        int opp_potential = __builtin_popcountll(empty & neighbours(mine));
+        double pm = my_potential + opp_potential > 0 ? 100.0 * (my_potential - opp_potential) / (my_potential + opp_potential) : 0;
+        double c, l;
+        corner_terms(input,c,l);
+        double m = share(input.next_valid_spots.size(),input.mobility(3 - input.cur_player));
+        double heu = (2 * p) + (20 * c) + (12 * l) + (15 * m) + (-5 * f) + (20 * d) + (5 * pm);
+        return (int)(heu * EVAL_SCALE);
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<PassThreeEval>(boards);
+    }
+};
+// temp.cpp: pass_three's terms with its own weights, whole number shares
+// and the frontier divided by the discs
+struct TempEval {
+    static int evaluate(OthelloBoard& input){
+        static const double price[8][8] = {
+            20,-3,11, 8, 8,11,-3,20,
+            -3,-7,-4, 1, 1,-4,-7,-3,
+            11,-4, 2, 2, 2, 2,-4,11,
+             8, 1, 2,-3,-3,2, 1, 8,
+             8, 1, 2,-3,-3,2, 1, 8,
+            11,-4, 2, 2, 2, 2,-4,11,
+            -3,-7,-4, 1, 1,-4,-7,-3,
+            20,-3,11, 8, 8,11,-3,20,
+        };
+        unsigned long long mine = input.bits[player], opp = input.bits[3 - player];
+        unsigned long long empty = input.bits[OthelloBoard::EMPTY];
+        double d = 0, p = 0, f = 0;
+        for(int sq=0;sq<64;sq++){
+            if((mine >> sq) & 1) d += price[sq / 8][sq % 8];
+            else if((opp >> sq) & 1) d -= price[sq / 8][sq % 8];
+        }
+        int my_tiles = __builtin_popcountll(mine), opp_tiles = __builtin_popcountll(opp);
+        int my_front_tiles = __builtin_popcountll(mine & neighbours(empty));
+        int opp_front_tiles = __builtin_popcountll(opp & neighbours(empty));
+        if(my_tiles > opp_tiles){
+            p = (my_tiles)*100/(my_tiles + opp_tiles);
+            f = -(my_front_tiles)*100/(my_tiles + opp_tiles);
+        }
+        else if(my_tiles < opp_tiles){
+            p = -(opp_tiles)*100/(my_tiles + opp_tiles);
+            f = (opp_front_tiles)*100/(my_tiles + opp_tiles);
+        }
+        int my_potential = __builtin_popcountll(empty & neighbours(opp));
+        int opp_potential = __builtin_popcountll(empty & neighbours(mine));
+        double pm = my_potential + opp_potential > 0 ? 100.0 * (my_potential - opp_potential) / (my_potential + opp_potential) : 0;
+        double c, l;
+        corner_terms(input,c,l);
+        double m = share(input.next_valid_spots.size(),input.mobility(3 - input.cur_player));
+        double heu =  (10 * p) + (400.724 * c) + (382.026 * l) + (78.922 * m) + (74.396 * f) + (10 * d) + (25 * pm);
+        return (int)(heu * EVAL_SCALE);
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<TempEval>(boards);
+    }
+};
+// stability of 1.2.3.5_ac.cpp and another_way_to_get_three.cpp: the run of
+// discs of the corner's colour along both edges from an occupied corner,
+// less 4 for a whole edge, positive for player
+int corner_stability(const OthelloBoard& input , Point dir_1 , Point dir_2 , Point place){
+    int owner = input.board[place.x][place.y];
+    if(owner == 0) return 0;
+    int ans = 0;
+    for(Point dir:{dir_1,dir_2}){
+        for(int i=0;i<8;i++){
+            if(input.board[place.x+dir.x*i][place.y+dir.y*i] != owner){
+                break;
+            }
+            ans++;
+            if(i == 7) ans -= 4;
+        }
+    }
+    return owner == player ? ans : -ans;
+}
+// the terms the two forks share: price table, mobility of the side to move,
+// corner stability and the three squares next to an empty corner
+void fork_terms(const OthelloBoard& input , double& board_value , double& motive , double& stable , int& next_to_corner){
+    board_value = 0;
+    for(int sq=0;sq<64;sq++){
+        if((input.bits[player] >> sq) & 1) board_value += price[sq / 8][sq % 8];
+        else if((input.bits[3 - player] >> sq) & 1) board_value -= price[sq / 8][sq % 8];
+    }
+    motive = input.next_valid_spots.size();
+    stable = corner_stability(input,Point(1,0),Point(0,1),Point(0,0)) + corner_stability(input,Point(-1,0),Point(0,1),Point(7,0)) + \
+    corner_stability(input,Point(1,0),Point(0,-1),Point(0,7)) + corner_stability(input,Point(-1,0),Point(0,-1),Point(7,7));
+    double c, l;
+    corner_terms(input,c,l);
+    // corner_terms gives -12.5 per net square
+    next_to_corner = (int)lround(l / 12.5);
+}
+// 1.2.3.5_ac.cpp: phases at 40 and 20 empties
+struct AcEval {
+    static int evaluate(OthelloBoard& input){
+        double board_value, motive, stable;
+        int next_to_corner;
+        fork_terms(input,board_value,motive,stable,next_to_corner);
+        int diff = input.disc_count[player] - input.disc_count[3 - player];
+        double heu = 0;
+        if(input.disc_count[0] > 40)
+            heu += 1*board_value + 10*stable + 10*motive + 10*next_to_corner - 5*diff;
+        if(input.disc_count[0] < 20)
+            heu += 1*board_value + 10*stable + 10*motive + 10*next_to_corner + 5*diff;
+        else
+            heu += 1*board_value + 10*stable + 10*motive + 10*next_to_corner;
+        return (int)(heu * EVAL_SCALE);
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<AcEval>(boards);
+    }
+};
+// another_way_to_get_three.cpp: no phases, 100 off for any corner of the
+// opponent
+struct ThreeEval {
+    static int evaluate(OthelloBoard& input){
+        double board_value, motive, stable;
+        int next_to_corner;
+        fork_terms(input,board_value,motive,stable,next_to_corner);
+        double heu = 0;
+        if(input.board[0][0] == 3- player || input.board[7][0] == 3- player ||
+        input.board[0][7] == 3- player || input.board[7][7] == 3- player ){
+            heu -= 100;
+        }
+        heu += 1*board_value + 10*stable + 10*motive + 10*next_to_corner;
+        return (int)(heu * EVAL_SCALE);
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<ThreeEval>(boards);
+    }
+};
+// NNUE output layer: out = b2[side] + clamp(acc, 0, NNUE_ONE) . w2[side]
+int nnue_output_scalar(const short* acc , int side){
+    const signed char* w = nnue_w2 + side * NNUE_HIDDEN;
+    int out = nnue_b2[side];
+    for(int i=0;i<NNUE_HIDDEN;i++){
+        out += std::max(0,std::min(NNUE_ONE,(int)acc[i])) * w[i];
+    }
+    return out;
+}
+#ifdef HAVE_AVX2
+// 32 activations at a time: clamp the int16 accumulator, pack it to uint8
+// and multiply with the int8 weights into int16 pairs, then int32
+__attribute__((target("avx2")))
+int nnue_output_avx2(const short* acc , int side){
+    const signed char* w = nnue_w2 + side * NNUE_HIDDEN;
+    const __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16(NNUE_ONE), ones = _mm256_set1_epi16(1);
+    __m256i sum = _mm256_setzero_si256();
+    for(int i=0;i<NNUE_HIDDEN;i+=32){
+        __m256i a0 = _mm256_loadu_si256((const __m256i*)(acc + i));
+        __m256i a1 = _mm256_loadu_si256((const __m256i*)(acc + i + 16));
+        a0 = _mm256_min_epi16(_mm256_max_epi16(a0,zero),one);
+        a1 = _mm256_min_epi16(_mm256_max_epi16(a1,zero),one);
+        // packus works per 128 bit half, the permute puts the bytes back in order
+        __m256i h = _mm256_permute4x64_epi64(_mm256_packus_epi16(a0,a1),0xD8);
+        __m256i prod = _mm256_maddubs_epi16(h,_mm256_loadu_si256((const __m256i*)(w + i)));
+        sum = _mm256_add_epi32(sum,_mm256_madd_epi16(prod,ones));
+    }
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum),_mm256_extracti128_si256(sum,1));
+    s = _mm_add_epi32(s,_mm_shuffle_epi32(s,0x4E));
+    s = _mm_add_epi32(s,_mm_shuffle_epi32(s,0xB1));
+    return nnue_b2[side] + _mm_cvtsi128_si32(s);
+}
+#endif
+// one disc of final difference is worth this much of a score
+const int NNUE_DISC_VALUE = 10 * EVAL_SCALE;
+// the network judges the positions with 20 or more empties, the endgame
+// phase keeps find_heuristic next to the exact solver
+struct NnueEval {
+    static int evaluate(OthelloBoard& b){
+        if(game_phase(b.disc_count[OthelloBoard::EMPTY]) == ENDGAME){
+            return b.find_heuristic(b);
+        }
+        int side = b.cur_player - 1;
+#ifdef HAVE_AVX2
+        int out = have_avx2 && NNUE_HIDDEN % 32 == 0 ? nnue_output_avx2(b.accumulator.data(),side) : \
+        nnue_output_scalar(b.accumulator.data(),side);
+#else
+        int out = nnue_output_scalar(b.accumulator.data(),side);
+#endif
+        long long black = (long long)out * NNUE_DISCS * NNUE_DISC_VALUE / (NNUE_ONE * NNUE_W2_ONE);
+        return player == OthelloBoard::BLACK ? black : -black;
+    }
+    static void evaluate_all(const std::vector<OthelloBoard*>& boards){
+        evaluate_each<NnueEval>(boards);
+    }
+};
+enum EVALUATOR {
+    EVAL_PHASE,
+    EVAL_PATTERNS,
+    EVAL_PASS_THREE,
+    EVAL_TEMP,
+    EVAL_AC,
+    EVAL_THREE,
+    EVAL_NNUE,
+    EVALUATORS
+};
+const char* const evaluator_names[EVALUATORS] = {"phase","patterns","pass_three","temp","ac","three","nnue"};
+int evaluator = EVAL_PHASE;
+// MY_PROJECT_EVAL=<name> picks the evaluator by evaluator_names, setting
+// MY_PROJECT_PATTERNS alone picks patterns
+void evaluator_init(){
+    const char* name = getenv("MY_PROJECT_EVAL");
+    if(!name){
+        evaluator = getenv("MY_PROJECT_PATTERNS") ? EVAL_PATTERNS : EVAL_PHASE;
+        return;
+    }
+    for(int e=0;e<EVALUATORS;e++){
+        if(std::string(name) == evaluator_names[e]){
+            evaluator = e;
+            return;
+        }
+    }
+    cerr << "unknown evaluator " << name << ", using " << evaluator_names[EVAL_PHASE] << endl;
+}
+MappedWeights nnue_file;
+// MY_PROJECT_NNUE=<file> maps the network of the nnue evaluator from a
+// weights file, without one it falls back to phase
+void nnue_init(){
+    const char* path = getenv("MY_PROJECT_NNUE");
+    if(path && weights_map(path,nnue_file)){
+        const void* w1 = weights_find(nnue_file.base,nnue_file.bytes,NNUE_W1,WEIGHT_I16,NNUE_INPUTS * NNUE_HIDDEN);
+        const void* b1 = weights_find(nnue_file.base,nnue_file.bytes,NNUE_B1,WEIGHT_I16,NNUE_HIDDEN);
+        const void* w2 = weights_find(nnue_file.base,nnue_file.bytes,NNUE_W2,WEIGHT_I8,2 * NNUE_HIDDEN);
+        const void* b2 = weights_find(nnue_file.base,nnue_file.bytes,NNUE_B2,WEIGHT_I32,2);
+        if(w1 && b1 && w2 && b2){
+            nnue_w1 = static_cast<const short*>(w1);
+            nnue_b1 = static_cast<const short*>(b1);
+            nnue_w2 = static_cast<const signed char*>(w2);
+            nnue_b2 = static_cast<const int*>(b2);
+            return;
+        }
+    }
+    cerr << "can't use network " << (path ? path : "(MY_PROJECT_NNUE not set)") << ", using " << evaluator_names[EVAL_PHASE] << endl;
+    evaluator = EVAL_PHASE;
+}
+// transposition table, remembers the best move found for a position and
+// the bound its score gives
+enum TT_BOUND {
+    TT_NONE,
+    TT_LOWER,   // the score failed high, the value is at least this
+    TT_UPPER,   // the score failed low, the value is at most this
+    TT_EXACT
+};
+struct TTEntry {
+    // search score from the side of the player in flags
+    int value;
+    signed char depth;
+    // x * 8 + y of the best move, -1 if there is none
+    signed char move;
+    // TT_BOUND in the low 2 bits, then 2 bits of the player the value
+    // belongs to and the evaluator that scored it
+    unsigned char flags;
+    // low byte of the table generation that wrote the entry
+    unsigned char generation;
+};
+static_assert(sizeof(TTEntry) == 8,"an entry is packed into one word");
+// A mapped table is shared with other engine processes (the referee's next
+// move, a pondering process, the other seat of a self-match), which may
+// store into a slot while this one reads it. The slot keeps key ^ data
+// rather than the key, so a read that mixes the words of two stores fails
+// the key check instead of returning one position's bound for another.
+struct TTSlot {
+    unsigned long long check;
+    unsigned long long data;
+};
+const int TT_BITS = 20;
+TTSlot* tt = nullptr;
+unsigned long long tt_mask = 0;
+unsigned char tt_generation = 0;
+std::vector<TTSlot> tt_heap;
+// layout of a table file: this header padded to TT_HEADER_BYTES, then the
+// entries. A file whose header does not match is cleared and reused.
+struct TTHeader {
+    char magic[8];
+    unsigned int version;
+    unsigned int entry_size;
+    unsigned long long entries;
+    // bumped by every process that maps the file, ages the older entries
+    unsigned long long generation;
+};
+const char TT_MAGIC[8] = {'O','T','H','E','L','L','T','T'};
+const unsigned int TT_VERSION = 3;
+const size_t TT_HEADER_BYTES = 64;
+// map the table from a file so the next process launched for the next move
+// starts with what this one learned, false if the file can't be used
+bool tt_map_file(const char* path){
+#ifdef HAVE_MMAP
+    const unsigned long long entries = 1ULL << TT_BITS;
+    const size_t bytes = TT_HEADER_BYTES + entries * sizeof(TTSlot);
+    int fd = open(path,O_RDWR | O_CREAT,0644);
+    if(fd < 0){
+        return false;
+    }
+    if(ftruncate(fd,bytes) != 0){
+        close(fd);
+        return false;
+    }
+    void* map = mmap(nullptr,bytes,PROT_READ | PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if(map == MAP_FAILED){
+        return false;
+    }
+    TTHeader* header = static_cast<TTHeader*>(map);
+    if(memcmp(header->magic,TT_MAGIC,sizeof(TT_MAGIC)) != 0 || header->version != TT_VERSION || \
+    header->entry_size != sizeof(TTSlot) || header->entries != entries){
+        memset(map,0,bytes);
+        memcpy(header->magic,TT_MAGIC,sizeof(TT_MAGIC));
+        header->version = TT_VERSION;
+        header->entry_size = sizeof(TTSlot);
+        header->entries = entries;
+    }
+    // other processes may map the file at the same time
+    tt_generation = __atomic_add_fetch(&header->generation,1,__ATOMIC_RELAXED);
+    tt = reinterpret_cast<TTSlot*>(static_cast<char*>(map) + TT_HEADER_BYTES);
+    tt_mask = entries - 1;
+    return true;
+#else
+    (void)path;
+    return false;
+#endif
+}
+// the table lives in the file named by MY_PROJECT_TT if it is set (the
+// referee only passes the state and action files), on the heap otherwise
+void tt_init(){
+    const char* path = getenv("MY_PROJECT_TT");
+    if(path && tt_map_file(path)){
+        return;
+    }
+    if(path){
+        cerr << "can't map transposition table file " << path << endl;
+    }
+    tt_heap.assign(1 << TT_BITS,TTSlot());
+    tt = tt_heap.data();
+    tt_mask = tt_heap.size() - 1;
+}
+TTEntry tt_unpack(unsigned long long data){
+    TTEntry e;
+    memcpy(&e,&data,sizeof(e));
+    return e;
+}
+// copies the entry of key to e, false if the table has none (or only a
+// torn one). Every word is read once, the check is on the words read.
+bool tt_probe(unsigned long long key , TTEntry& e){
+    TTSlot& slot = tt[key & tt_mask];
+    unsigned long long data = __atomic_load_n(&slot.data,__ATOMIC_RELAXED);
+    unsigned long long check = __atomic_load_n(&slot.check,__ATOMIC_RELAXED);
+    if((check ^ data) != key){
+        return false;
+    }
+    e = tt_unpack(data);
+    return true;
+}
+// a deeper entry of the current generation is kept, entries left over from
+// earlier searches are always replaced
+void tt_store(unsigned long long key , int depth , Point move , int value , int bound){
+    TTSlot& slot = tt[key & tt_mask];
+    TTEntry old = tt_unpack(__atomic_load_n(&slot.data,__ATOMIC_RELAXED));
+    if(old.generation == tt_generation && old.depth > depth){
+        return;
+    }
+    TTEntry e;
+    e.value = value;
+    e.depth = depth;
+    e.move = move.x < 0 ? -1 : move.x * 8 + move.y;
+    e.flags = bound | player << 2 | evaluator << 4;
+    e.generation = tt_generation;
+    unsigned long long data;
+    memcpy(&data,&e,sizeof(data));
+    __atomic_store_n(&slot.check,key ^ data,__ATOMIC_RELAXED);
+    __atomic_store_n(&slot.data,data,__ATOMIC_RELAXED);
+}
+// the bound a search of the window alpha..beta proved for its score
+int tt_bound(int value , int alpha , int beta){
+    return value <= alpha ? TT_UPPER : value >= beta ? TT_LOWER : TT_EXACT;
+}
+// the remembered best move of the position, (-1,-1) if there is none
+Point tt_move(const OthelloBoard& board){
+    TTEntry e;
+    if(tt_probe(board.key(),e)){
+        for(auto it:board.next_valid_spots){
+            if(e.move == it.x * 8 + it.y){
+                return it;
+            }
+        }
+    }
+    return Point(-1,-1);
+}
+// moves in search order, the remembered best move first
+std::vector<Point> ordered_moves(const OthelloBoard& board){
+    std::vector<Point> moves = board.next_valid_spots;
+    Point first = tt_move(board);
+    for(size_t i=1;i<moves.size();i++){
+        if(moves[i] == first){
+            std::rotate(moves.begin(),moves.begin()+i,moves.begin()+i+1);
+            break;
+        }
+    }
+    return moves;
+}
+// value of a finished game or of the heuristic
+int leaf_value(const OthelloBoard& board){
+    if(board.done){
+        if(board.winner == 3 - player){
+            return -INF + 100;
+        }
+        else if(board.winner == player){
+            return INF;
+        }
+    }
+    return board.heuristic;
+}
+// nodes at least this far from the leaves expand and order their children
+// with the batch evaluation. Closer to the leaves a cutoff usually comes
+// before most children are played, so they are played one by one.
+const int BATCH_DEPTH = 3;
+// all children of board, evaluated together. order is the search order: the
+// remembered best move first, the rest best first for the side choosing
+// (state 1 -> max / state 0 -> min) by their leaf values.
+template<class Eval>
+std::vector<OthelloBoard> expand(const OthelloBoard& board , int state , std::vector<int>& order){
+    std::vector<OthelloBoard> children;
+    children.reserve(board.next_valid_spots.size());
+    for(auto it:board.next_valid_spots){
+        children.push_back(play_move(board,it));
+    }
+    evaluate_children<Eval>(children);
+    std::vector<int> value(children.size());
+    Point first = tt_move(board);
+    for(size_t i=0;i<children.size();i++){
+        value[i] = children[i].played_disc == first ? (state == 1 ? INF + 1 : -INF - 1) : leaf_value(children[i]);
+    }
+    order.resize(children.size());
+    for(size_t i=0;i<order.size();i++){
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(),order.end(),[&](int a , int b){
+        return state == 1 ? value[a] > value[b] : value[a] < value[b];
+    });
+    return children;
+}
+// state 1 -> find max / state 0 ->find min
+// alpha and beta bound this node only, pv receives the principal variation
+// below it. Whose turn it is comes from the board, so passes keep the side.
+template<class Eval>
+int search(OthelloBoard& board , int alpha , int beta , int depth , int state , std::vector<Point>& pv){
+    pv.clear();
+    if(board.done || depth == 0){
+        return leaf_value(board);
+    }
+    // a deep enough bound that already cuts the window, scores inside the
+    // window are searched again so the node gets its principal variation
+    TTEntry e;
+    if(tt_probe(board.key(),e) && e.depth >= depth && (e.flags >> 2) == (player | evaluator << 2)){
+        int bound = e.flags & 3;
+        if((bound == TT_LOWER || bound == TT_EXACT) && e.value >= beta){
+            return e.value;
+        }
+        if((bound == TT_UPPER || bound == TT_EXACT) && e.value <= alpha){
+            return e.value;
+        }
+    }
+    const int alpha0 = alpha, beta0 = beta;
+    int k = depth;
+    k--;
+    Point best(-1,-1);
+    std::vector<Point> line;
+    std::vector<int> order;
+    std::vector<OthelloBoard> children;
+    std::vector<Point> moves;
+    if(depth >= BATCH_DEPTH){
+        children = expand<Eval>(board,state,order);
+    }
+    else{
+        moves = ordered_moves(board);
+        for(size_t i=0;i<moves.size();i++){
+            order.push_back(i);
+        }
+    }
+    OthelloBoard played;
+    if(state == 1){
+        int val = -INF;
+        for(int i:order){
+            if(search_stopped()){
+                return val;
+            }
+            if(children.empty()){
+                played = update<Eval>(board,moves[i]);
+            }
+            OthelloBoard& next = children.empty() ? played : children[i];
+            Point it = next.played_disc;
+            int value = search<Eval>(next,alpha,beta,k,next.cur_player == player,line);
+            if(value > val){
+                val = value;
+                best = it;
+                pv.assign(1,it);
+                pv.insert(pv.end(),line.begin(),line.end());
+            }
+            if(val > alpha){
+                alpha = val;
+            }
+            if(alpha >= beta){
+                break;
+            }
+        }
+        if(!search_stopped()){
+            tt_store(board.key(),depth,best,val,tt_bound(val,alpha0,beta0));
+        }
+        return val;
+    }
+    else if(state == 0){
+        int val = INF;
+        for(int i:order){
+            if(search_stopped()){
+                return val;
+            }
+            if(children.empty()){
+                played = update<Eval>(board,moves[i]);
+            }
+            OthelloBoard& next = children.empty() ? played : children[i];
+            Point it = next.played_disc;
+            int value = search<Eval>(next,alpha,beta,k,next.cur_player == player,line);
+            if(value < val){
+                val = value;
+                best = it;
+                pv.assign(1,it);
+                pv.insert(pv.end(),line.begin(),line.end());
+            }
+            if(val < beta){
+                beta = val;
+            }
+            if(alpha >= beta){
+                //cout << "cutoff" << endl;
+                break;
+            }
+        }
+        if(!search_stopped()){
+            tt_store(board.key(),depth,best,val,tt_bound(val,alpha0,beta0));
+        }
+        return val;
+    }
+    return -1;
+}
+// one analysed root move, pv starts with the move itself
+struct RootLine {
+    Point move;
+    int score;
+    std::vector<Point> pv;
+};
+// number of best root moves that get exact scores and principal variations
+int multipv = 1;
+// search every root move to the given depth, false if the search was stopped.
+// Each move is searched with alpha at the multipv-th best score found so far,
+// so the best multipv moves come back exact and the rest fail low. lines
+// holds the previous depth's result on entry (searched first) and this one's
+// on success, best first.
+template<class Eval>
+bool search_root(OthelloBoard& cur , int depth , std::vector<RootLine>& lines){
+    std::vector<Point> order;
+    for(auto& l:lines){
+        order.push_back(l.move);
+    }
+    for(auto it:ordered_moves(cur)){
+        if(std::find(order.begin(),order.end(),it) == order.end()){
+            order.push_back(it);
+        }
+    }
+    std::vector<RootLine> result;
+    std::vector<Point> line;
+    for(auto it:order){
+        int alpha = (int)result.size() < multipv ? -INF : result.back().score;
+        OthelloBoard new_one = update<Eval>(cur,it);
+        int val = search<Eval>(new_one,alpha,INF,depth,new_one.cur_player == player,line);
+        if(search_stopped()){
+            return false;
+        }
+        if((int)result.size() < multipv || val > alpha){
+            RootLine r;
+            r.move = it;
+            r.score = val;
+            r.pv.assign(1,it);
+            r.pv.insert(r.pv.end(),line.begin(),line.end());
+            auto pos = result.begin();
+            while(pos != result.end() && pos->score >= val){
+                pos++;
+            }
+            result.insert(pos,r);
+            if((int)result.size() > multipv){
+                result.pop_back();
+            }
+        }
+    }
+    lines = result;
+    cur.played_disc = lines[0].move;
+    tt_store(cur.key(),depth + 1,lines[0].move,lines[0].score,TT_EXACT);
+    return true;
+}
+// one line per analysed move:
+// info depth <d> multipv <rank> score <s> nodes <n> pv <x> <y> <x> <y> ...
+void print_lines(int depth , const std::vector<RootLine>& lines){
+    for(size_t i=0;i<lines.size();i++){
+        *info << "info depth " << depth << " multipv " << i + 1 << " score " << lines[i].score << " nodes " << nodes << " pv";
+        for(auto p:lines[i].pv){
+            *info << " " << p.x << " " << p.y;
+        }
+        *info << endl;
+    }
+}
+// iterative deepening over the depths first..last, cur.played_disc ends up as
+// the move of the deepest finished depth, which is returned (first-1 if none)
+template<class Eval>
+int deepen(OthelloBoard& cur , int first , int last , std::vector<RootLine>& lines){
+    int finished = first - 1;
+    for(int depth = first;depth <= last;depth++){
+        if(!search_root<Eval>(cur,depth,lines)){
+            break;
+        }
+        finished = depth;
+        print_lines(depth,lines);
+    }
+    return finished;
+}
+// deepen with the evaluator picked at startup
+int deepen(OthelloBoard& cur , int first , int last , std::vector<RootLine>& lines){
+    switch(evaluator){
+        case EVAL_PATTERNS: return deepen<PatternEval>(cur,first,last,lines);
+        case EVAL_PASS_THREE: return deepen<PassThreeEval>(cur,first,last,lines);
+        case EVAL_TEMP: return deepen<TempEval>(cur,first,last,lines);
+        case EVAL_AC: return deepen<AcEval>(cur,first,last,lines);
+        case EVAL_THREE: return deepen<ThreeEval>(cur,first,last,lines);
+        case EVAL_NNUE: return deepen<NnueEval>(cur,first,last,lines);
+        default: return deepen<PhaseEval>(cur,first,last,lines);
+    }
+}
+// interleaved searches: a SearchTask is the fixed depth search of
+// search_root, with its stack of nodes kept in the task instead of on the
+// call stack, so it can stop whenever it needs an evaluation and go on
+// later, the way a coroutine would. Nodes follow search: from BATCH_DEPTH up
+// they play every move and wait for the heuristics of all the children to
+// order them, closer to the leaves the moves are played one by one and only
+// the last ply waits, for one leaf at a time. search_many runs any number of
+// tasks side by side and evaluates what they wait for in one batch per
+// side, so hundreds of games in one process give the batch evaluator wide
+// batches even where a single search would evaluate one leaf. A task keeps
+// its own player and node count, search_many sets the global player (the
+// transposition table and evaluation cache entries are per player) while it
+// runs a task or evaluates for its side. The batches skip the evaluation
+// cache, across games it misses more than it saves.
+struct SearchTask {
+    // searches the moves of root to depth plies below them, for player
+    SearchTask(const OthelloBoard& root , int player , int depth) : player(player), nodes(0), score(0) {
+        push(root,-INF,INF,depth + 1);
+    }
+    bool finished() const {
+        return stack.empty();
+    }
+    // runs until the task waits for the heuristics of pending or ends
+    void resume(){
+        pending.clear();
+        while(!stack.empty()){
+            Frame& f = stack.back();
+            if(!f.opened){
+                f.opened = true;
+                if(f.board.done){
+                    pop(value(f.board));
+                    continue;
+                }
+                TTEntry e;
+                if(stack.size() > 1 && tt_probe(f.board.key(),e) && e.depth >= f.depth && (e.flags >> 2) == (player | evaluator << 2)){
+                    int bound = e.flags & 3;
+                    if(((bound == TT_LOWER || bound == TT_EXACT) && e.value >= f.beta) || \
+                    ((bound == TT_UPPER || bound == TT_EXACT) && e.value <= f.alpha)){
+                        pop(e.value);
+                        continue;
+                    }
+                }
+                if(f.depth >= BATCH_DEPTH){
+                    f.children.reserve(f.board.next_valid_spots.size());
+                    for(auto p:f.board.next_valid_spots){
+                        f.children.push_back(play(f.board,p));
+                        pending.push_back(&f.children.back());
+                    }
+                    return;
+                }
+                f.moves = ordered_moves(f.board);
+            }
+            if(!f.children.empty() && f.order.empty()){
+                order(f);
+            }
+            if(f.waiting){
+                f.waiting = false;
+                take(f,value(f.leaf),f.leaf.played_disc);
+            }
+            const size_t count = f.children.empty() ? f.moves.size() : f.children.size();
+            if(f.next == count || f.alpha >= f.beta){
+                pop(f.value);
+                continue;
+            }
+            if(!f.children.empty()){
+                push(f.children[f.order[f.next++]],f.alpha,f.beta,f.depth - 1);
+                continue;
+            }
+            OthelloBoard child = play(f.board,f.moves[f.next++]);
+            if(f.depth > 1){
+                push(child,f.alpha,f.beta,f.depth - 1);
+            }
+            else if(child.done){
+                take(f,value(child),child.played_disc);
+            }
+            else{
+                f.leaf = child;
+                f.waiting = true;
+                pending.push_back(&f.leaf);
+                return;
+            }
+        }
+    }
+    int player;
+    long long nodes;
+    // best root move and its score for player, once finished
+    Point move;
+    int score;
+    // boards waiting for their heuristics
+    std::vector<OthelloBoard*> pending;
+private:
+    struct Frame {
+        OthelloBoard board;
+        // all children and their search order, or the moves to play one by one
+        std::vector<OthelloBoard> children;
+        std::vector<int> order;
+        std::vector<Point> moves;
+        // the last ply's child waiting for its heuristic
+        OthelloBoard leaf;
+        bool opened, waiting;
+        size_t next;
+        int alpha, beta, alpha0, beta0, value, depth;
+        Point best;
+    };
+    std::vector<Frame> stack;
+    bool maximising(const Frame& f) const {
+        return f.board.cur_player == player;
+    }
+    // leaf_value for the task's player
+    int value(const OthelloBoard& board) const {
+        if(board.done){
+            return board.winner == player ? INF : board.winner == 3 - player ? -INF + 100 : 0;
+        }
+        return board.heuristic;
+    }
+    OthelloBoard play(const OthelloBoard& board , Point p){
+        nodes++;
+        OthelloBoard child(board);
+        child.put_disc(p);
+        child.played_disc = p;
+        return child;
+    }
+    // expand's order: the remembered best move, then best first for the
+    // side to move
+    void order(Frame& f){
+        std::vector<int> v(f.children.size());
+        const bool max = maximising(f);
+        const Point first = tt_move(f.board);
+        for(size_t i=0;i<f.children.size();i++){
+            f.order.push_back(i);
+            v[i] = f.children[i].played_disc == first ? (max ? INF + 1 : -INF - 1) : value(f.children[i]);
+        }
+        std::stable_sort(f.order.begin(),f.order.end(),[&](int a , int b){
+            return max ? v[a] > v[b] : v[a] < v[b];
+        });
+    }
+    // board is a copy, growing the stack may move the parent's children
+    void push(OthelloBoard board , int alpha , int beta , int depth){
+        stack.emplace_back();
+        Frame& f = stack.back();
+        f.board = board;
+        f.opened = f.waiting = false;
+        f.next = 0;
+        f.alpha = f.alpha0 = alpha;
+        f.beta = f.beta0 = beta;
+        f.value = maximising(f) ? -INF - 1 : INF + 1;
+        f.depth = depth;
+        f.best = board.next_valid_spots.empty() ? Point(-1,-1) : board.next_valid_spots[0];
+    }
+    // a child of f, reached by move, is worth val
+    void take(Frame& f , int val , Point move){
+        if(maximising(f) ? val > f.value : val < f.value){
+            f.value = val;
+            f.best = move;
+        }
+        if(maximising(f)){
+            f.alpha = std::max(f.alpha,val);
+        }
+        else{
+            f.beta = std::min(f.beta,val);
+        }
+    }
+    // the top node is done with val, its parent takes it
+    void pop(int val){
+        Frame& f = stack.back();
+        const Point played = f.board.played_disc;
+        if(f.opened && !f.board.done && (f.next > 0 || f.waiting)){
+            tt_store(f.board.key(),f.depth,f.best,val,tt_bound(val,f.alpha0,f.beta0));
+        }
+        if(stack.size() == 1){
+            move = f.best;
+            score = val;
+        }
+        stack.pop_back();
+        if(!stack.empty()){
+            take(stack.back(),val,played);
+        }
+    }
+};
+// runs every task to its end
+template<class Eval>
+void search_many(std::vector<SearchTask>& tasks){
+    const int saved = player;
+    std::vector<OthelloBoard*> waiting[3];
+    for(;;){
+        waiting[OthelloBoard::BLACK].clear();
+        waiting[OthelloBoard::WHITE].clear();
+        for(auto& t:tasks){
+            if(!t.finished()){
+                player = t.player;
+                t.resume();
+                waiting[t.player].insert(waiting[t.player].end(),t.pending.begin(),t.pending.end());
+            }
+        }
+        if(waiting[OthelloBoard::BLACK].empty() && waiting[OthelloBoard::WHITE].empty()){
+            break;
+        }
+        for(int side=OthelloBoard::BLACK;side<=OthelloBoard::WHITE;side++){
+            if(!waiting[side].empty()){
+                player = side;
+                Eval::evaluate_all(waiting[side]);
+            }
+        }
+    }
+    player = saved;
+}
+// search_many with the evaluator picked at startup
+void search_many(std::vector<SearchTask>& tasks){
+    switch(evaluator){
+        case EVAL_PATTERNS: return search_many<PatternEval>(tasks);
+        case EVAL_PASS_THREE: return search_many<PassThreeEval>(tasks);
+        case EVAL_TEMP: return search_many<TempEval>(tasks);
+        case EVAL_AC: return search_many<AcEval>(tasks);
+        case EVAL_THREE: return search_many<ThreeEval>(tasks);
+        case EVAL_NNUE: return search_many<NnueEval>(tasks);
+        default: return search_many<PhaseEval>(tasks);
+    }
+}
+// endgame store: bounds of solved endgame positions, kept in a memory-mapped
+// file across moves and games. Positions are keyed by the smallest zobrist
+// key over the 8 symmetries of the board, so mirrored endgames share an
+// entry. Bounds are final disc differences for the side to move.
+struct EndgameEntry {
+    signed char lower, upper;
+    // empties of the position, the work a solve costs grows with it
+    unsigned char empties;
+    unsigned char pad;
+    // store clock at the last use, for lru eviction
+    unsigned int stamp;
+};
+static_assert(sizeof(EndgameEntry) == 8,"an entry is packed into one word");
+// the store is shared like a mapped transposition table, so its slots keep
+// key ^ data in the same way (see TTSlot). A free slot is all zero.
+struct EndgameSlot {
+    unsigned long long check;
+    unsigned long long data;
+};
+struct EndgameHeader {
+    char magic[8];
+    unsigned int version;
+    unsigned int entry_size;
+    unsigned long long entries;
+    unsigned long long clock;
+};
+const char ENDGAME_MAGIC[8] = {'O','T','H','E','L','L','E','G'};
+const unsigned int ENDGAME_VERSION = 2;
+const size_t ENDGAME_HEADER_BYTES = 64;
+// entries per bucket, one bucket fills a cache line
+const int ENDGAME_WAYS = 4;
+// positions with fewer empties are cheaper to solve than to look up
+const int ENDGAME_STORE_EMPTIES = 6;
+// stability cutoffs are tried in the solver from this many empties on
+const int ENDGAME_STABLE_EMPTIES = 5;
+// the root is solved exactly from this many empties on
+const int ENDGAME_EMPTIES = 12;
+enum EVICTION {
+    EVICT_LRU,   // the least recently used entry of the bucket goes
+    EVICT_WORK   // the entry with the fewest empties goes, the cheapest to redo
+};
+EndgameHeader* endgame_header = nullptr;
+EndgameSlot* endgame = nullptr;
+unsigned long long endgame_buckets = 0;
+int endgame_eviction = EVICT_LRU;
+// MY_PROJECT_ENDGAME=<file> enables the store, MY_PROJECT_ENDGAME_MB sets
+// its size (16 by default, a file of another size is cleared) and
+// MY_PROJECT_ENDGAME_EVICT=lru|work the eviction policy
+void endgame_init(){
+#ifdef HAVE_MMAP
+    const char* path = getenv("MY_PROJECT_ENDGAME");
+    if(!path){
+        return;
+    }
+    const char* mb = getenv("MY_PROJECT_ENDGAME_MB");
+    const char* evict = getenv("MY_PROJECT_ENDGAME_EVICT");
+    if(evict && std::string(evict) == "work"){
+        endgame_eviction = EVICT_WORK;
+    }
+    unsigned long long bytes_wanted = (mb ? std::max(1LL,atoll(mb)) : 16) << 20;
+    unsigned long long buckets = 1;
+    while(buckets * 2 * ENDGAME_WAYS * sizeof(EndgameSlot) <= bytes_wanted){
+        buckets *= 2;
+    }
+    const unsigned long long entries = buckets * ENDGAME_WAYS;
+    const size_t bytes = ENDGAME_HEADER_BYTES + entries * sizeof(EndgameSlot);
+    int fd = open(path,O_RDWR | O_CREAT,0644);
+    if(fd < 0){
+        cerr << "can't open endgame store " << path << endl;
+        return;
+    }
+    if(ftruncate(fd,bytes) != 0){
+        close(fd);
+        cerr << "can't size endgame store " << path << endl;
+        return;
+    }
+    void* map = mmap(nullptr,bytes,PROT_READ | PROT_WRITE,MAP_SHARED,fd,0);
+    close(fd);
+    if(map == MAP_FAILED){
+        cerr << "can't map endgame store " << path << endl;
+        return;
+    }
+    EndgameHeader* header = static_cast<EndgameHeader*>(map);
+    if(memcmp(header->magic,ENDGAME_MAGIC,sizeof(ENDGAME_MAGIC)) != 0 || header->version != ENDGAME_VERSION || \
+    header->entry_size != sizeof(EndgameSlot) || header->entries != entries){
+        memset(map,0,bytes);
+        memcpy(header->magic,ENDGAME_MAGIC,sizeof(ENDGAME_MAGIC));
+        header->version = ENDGAME_VERSION;
+        header->entry_size = sizeof(EndgameSlot);
+        header->entries = entries;
+    }
+    endgame_header = header;
+    endgame = reinterpret_cast<EndgameSlot*>(static_cast<char*>(map) + ENDGAME_HEADER_BYTES);
+    endgame_buckets = buckets;
+#endif
+}
+// the smallest key over the 8 symmetries, with the side to move
+unsigned long long canonical_key(const OthelloBoard& board){
+    unsigned long long keys[8] = {0,0,0,0,0,0,0,0};
+    for(int i=0;i<8;i++){
+        for(int j=0;j<8;j++){
+            int d = board.board[i][j];
+            if(d == OthelloBoard::EMPTY){
+                continue;
+            }
+            keys[0] ^= zobrist.piece[d][i*8+j];
+            keys[1] ^= zobrist.piece[d][j*8+i];
+            keys[2] ^= zobrist.piece[d][(7-i)*8+j];
+            keys[3] ^= zobrist.piece[d][i*8+(7-j)];
+            keys[4] ^= zobrist.piece[d][(7-i)*8+(7-j)];
+            keys[5] ^= zobrist.piece[d][(7-j)*8+(7-i)];
+            keys[6] ^= zobrist.piece[d][j*8+(7-i)];
+            keys[7] ^= zobrist.piece[d][(7-j)*8+i];
+        }
+    }
+    unsigned long long key = *std::min_element(keys,keys+8);
+    key = board.cur_player == OthelloBoard::WHITE ? key ^ zobrist.side : key;
+    // 0 marks a free entry
+    return key ? key : 1;
+}
+// the key a slot holds, 0 if it is free or torn; data gets its entry word
+unsigned long long endgame_read(EndgameSlot& slot , unsigned long long& data){
+    data = __atomic_load_n(&slot.data,__ATOMIC_RELAXED);
+    return __atomic_load_n(&slot.check,__ATOMIC_RELAXED) ^ data;
+}
+void endgame_write(EndgameSlot& slot , unsigned long long key , EndgameEntry& e){
+    e.stamp = __atomic_add_fetch(&endgame_header->clock,1,__ATOMIC_RELAXED);
+    unsigned long long data;
+    memcpy(&data,&e,sizeof(data));
+    __atomic_store_n(&slot.check,key ^ data,__ATOMIC_RELAXED);
+    __atomic_store_n(&slot.data,data,__ATOMIC_RELAXED);
+}
+// copies the entry of key to e and marks it used, false if there is none
+bool endgame_probe(unsigned long long key , EndgameEntry& e){
+    EndgameSlot* bucket = endgame + (key & (endgame_buckets - 1)) * ENDGAME_WAYS;
+    for(int i=0;i<ENDGAME_WAYS;i++){
+        unsigned long long data;
+        if(endgame_read(bucket[i],data) == key){
+            memcpy(&e,&data,sizeof(e));
+            endgame_write(bucket[i],key,e);
+            return true;
+        }
+    }
+    return false;
+}
+// tighten the bounds of a position, making room by the eviction policy
+void endgame_store(unsigned long long key , int empties , int lower , int upper){
+    EndgameSlot* bucket = endgame + (key & (endgame_buckets - 1)) * ENDGAME_WAYS;
+    EndgameEntry entries[ENDGAME_WAYS];
+    unsigned long long keys[ENDGAME_WAYS];
+    for(int i=0;i<ENDGAME_WAYS;i++){
+        unsigned long long data;
+        keys[i] = endgame_read(bucket[i],data);
+        memcpy(&entries[i],&data,sizeof(data));
+    }
+    int way = -1;
+    for(int i=0;i<ENDGAME_WAYS && way < 0;i++){
+        if(keys[i] == key){
+            way = i;
+            lower = std::max(lower,(int)entries[i].lower);
+            upper = std::min(upper,(int)entries[i].upper);
+        }
+    }
+    for(int i=0;i<ENDGAME_WAYS && way < 0;i++){
+        if(keys[i] == 0){
+            way = i;
+        }
+    }
+    if(way < 0){
+        way = 0;
+        for(int i=1;i<ENDGAME_WAYS;i++){
+            const EndgameEntry& c = entries[i];
+            const EndgameEntry& e = entries[way];
+            bool older = c.stamp < e.stamp;
+            if(endgame_eviction == EVICT_WORK ? (c.empties < e.empties || (c.empties == e.empties && older)) : older){
+                way = i;
+            }
+        }
+    }
+    EndgameEntry e;
+    e.lower = lower;
+    e.upper = upper;
+    e.empties = empties;
+    e.pad = 0;
+    endgame_write(bucket[way],key,e);
+}
+// final disc difference for the side to move under perfect play, fail-soft
+// inside (alpha,beta). Consults the endgame store before searching.
+int solve(const OthelloBoard& board , int alpha , int beta){
+    if(board.done){
+        return board.disc_count[board.cur_player] - board.disc_count[3 - board.cur_player];
+    }
+    const int empties = board.disc_count[0];
+    const bool use_store = endgame && empties >= ENDGAME_STORE_EMPTIES;
+    unsigned long long key = 0;
+    if(use_store){
+        key = canonical_key(board);
+        EndgameEntry e;
+        if(endgame_probe(key,e)){
+            if(e.lower == e.upper || e.lower >= beta){
+                return e.lower;
+            }
+            if(e.upper <= alpha){
+                return e.upper;
+            }
+            alpha = std::max(alpha,(int)e.lower);
+            beta = std::min(beta,(int)e.upper);
+        }
+    }
+    if(empties >= ENDGAME_STABLE_EMPTIES){
+        // the opponent keeps its stable discs, which caps our final margin
+        int upper = 64 - 2 * __builtin_popcountll(board.stable_discs()[3 - board.cur_player]);
+        if(upper <= alpha){
+            return upper;
+        }
+    }
+    const int alpha_in = alpha;
+    int val = -65;
+    for(auto it:ordered_moves(board)){
+        if(search_stopped()){
+            return val;
+        }
+        OthelloBoard next(board);
+        next.put_disc(it);
+        nodes++;
+        int value;
+        if(next.cur_player == board.cur_player){
+            value = solve(next,alpha,beta);
+        }
+        else{
+            value = -solve(next,-beta,-alpha);
+        }
+        if(value > val){
+            val = value;
+        }
+        if(val > alpha){
+            alpha = val;
+        }
+        if(alpha >= beta){
+            break;
+        }
+    }
+    if(use_store && !search_stopped()){
+        endgame_store(key,empties,val > alpha_in ? val : -64,val < beta ? val : 64);
+    }
+    return val;
+}
+// exact endgame search of the root, false if the search was stopped
+bool solve_root(OthelloBoard& cur , std::vector<RootLine>& lines){
+    RootLine best;
+    best.score = -65;
+    for(auto it:ordered_moves(cur)){
+        OthelloBoard next(cur);
+        next.put_disc(it);
+        nodes++;
+        int val;
+        if(next.cur_player == cur.cur_player){
+            val = solve(next,best.score,65);
+        }
+        else{
+            val = -solve(next,-65,-best.score);
+        }
+        if(search_stopped()){
+            return false;
+        }
+        if(val > best.score){
+            best.move = it;
+            best.score = val;
+            best.pv.assign(1,it);
+        }
+    }
+    lines.assign(1,best);
+    cur.played_disc = best.move;
+    print_lines(cur.disc_count[0],lines);
+    return true;
+}
+// Monte Carlo tree search, the engine picked by MY_PROJECT_MCTS=<threads>.
+// A node's children are scored by PUCT,
+//   Q + MCTS_C * P * sqrt(N(node)) / (1 + N)
+// with Q and P from the evaluator: when a node is expanded every child gets
+// its evaluation as a win probability, which counts as one visit in Q, and
+// a softmax of the evaluations as its prior P. The nodes live in a pool of
+// parallel arrays, the children of a node next to each other, and keep only
+// the move into them; boards are replayed from the root. The threads descend
+// together, a visit counts as soon as it passes a node (virtual loss) so the
+// others spread out, and its value is added on the way back. The tree
+// outlives the move: a search starts from the node of its position if that
+// is the root or up to two moves below it, as in the persistent process.
+const int MCTS_BITS = 20;
+const double MCTS_C = 1.5;
+// an evaluation of MCTS_VALUE_SCALE is a 73% win probability, priors are a
+// softmax of evaluation / MCTS_PRIOR_SCALE
+const double MCTS_VALUE_SCALE = 500 * EVAL_SCALE;
+const double MCTS_PRIOR_SCALE = 150 * EVAL_SCALE;
+// playouts of a move without a node budget
+const long long MCTS_PLAYOUTS = 10000;
+// summed values are fixed point, a win is MCTS_ONE
+const long long MCTS_ONE = 1 << 16;
+enum MCTS_STATE {
+    MCTS_LEAF,
+    MCTS_EXPANDING,
+    MCTS_EXPANDED
+};
+struct MctsTree {
+    // move into the node, x*8+y
+    std::vector<signed char> move;
+    std::vector<unsigned char> child_count;
+    std::vector<int> first_child;
+    // prior, and the evaluation as a win probability for the side that moved
+    std::vector<float> prior, init;
+    std::vector<std::atomic<int>> visits, state;
+    // summed values for the side that moved into the node
+    std::vector<std::atomic<long long>> value;
+    std::atomic<int> used;
+    int root;
+    OthelloBoard root_board;
+    // playouts of the running search
+    std::atomic<long long> playouts;
+};
+int mcts_threads = 0;
+// random playouts per leaf, MY_PROJECT_MCTS_ROLLOUTS; 0 values the leaves by
+// the evaluator
+int mcts_rollouts = 0;
+MctsTree mcts;
+
+void mcts_init(){
+    const char* threads = getenv("MY_PROJECT_MCTS");
+    if(!threads){
+        return;
+    }
+    mcts_threads = std::max(1,atoi(threads));
+    const char* rollouts = getenv("MY_PROJECT_MCTS_ROLLOUTS");
+    mcts_rollouts = rollouts ? std::max(0,atoi(rollouts)) : 0;
+    const size_t n = 1 << MCTS_BITS;
+    mcts.move.resize(n);
+    mcts.child_count.resize(n);
+    mcts.first_child.resize(n);
+    mcts.prior.resize(n);
+    mcts.init.resize(n);
+    mcts.visits = std::vector<std::atomic<int>>(n);
+    mcts.state = std::vector<std::atomic<int>>(n);
+    mcts.value = std::vector<std::atomic<long long>>(n);
+    mcts.used = 0;
+}
+void mcts_clear(int node , int move){
+    mcts.move[node] = move;
+    mcts.child_count[node] = 0;
+    mcts.visits[node] = 0;
+    mcts.value[node] = 0;
+    mcts.state[node] = MCTS_LEAF;
+}
+Point mcts_point(int node){
+    return Point(mcts.move[node] / 8,mcts.move[node] % 8);
+}
+// the node of cur if it is the root or up to two moves below it
+int mcts_find(const OthelloBoard& cur , int node , const OthelloBoard& board , int depth){
+    if(board.key() == cur.key()){
+        return node;
+    }
+    if(depth == 0 || mcts.state[node] != MCTS_EXPANDED){
+        return -1;
+    }
+    for(int c=mcts.first_child[node];c<mcts.first_child[node] + mcts.child_count[node];c++){
+        OthelloBoard next(board);
+        next.put_disc(mcts_point(c));
+        int found = mcts_find(cur,c,next,depth - 1);
+        if(found >= 0){
+            return found;
+        }
+    }
+    return -1;
+}
+// makes cur the root, keeping its subtree when the tree has it and the pool
+// has room to grow it
+void mcts_set_root(const OthelloBoard& cur){
+    int found = -1;
+    if(mcts.used > 0 && mcts.used < (int)mcts.move.size() / 4 * 3){
+        found = mcts_find(cur,mcts.root,mcts.root_board,2);
+    }
+    if(found < 0){
+        mcts.used = 1;
+        mcts_clear(0,-1);
+        found = 0;
+    }
+    mcts.root = found;
+    mcts.root_board = cur;
+}
+double mcts_sigmoid(double evaluation){
+    return 1 / (1 + std::exp(-evaluation / MCTS_VALUE_SCALE));
+}
+// win probability of a finished game for side
+double mcts_result(const OthelloBoard& board , int side){
+    return board.winner == side ? 1 : board.winner == 3 - side ? 0 : 0.5;
+}
+// win probability for the side to move of board by mcts_rollouts playouts
+double mcts_rollout(const OthelloBoard& board){
+    static std::atomic<unsigned long long> seeds(1);
+    thread_local Xorshift rng(seeds++ * 0x9E3779B97F4A7C15ULL);
+    const int CHUNK = 16;
+    unsigned long long me[CHUNK], opp[CHUNK];
+    int margins[CHUNK];
+    std::fill(me,me + CHUNK,board.bits[board.cur_player]);
+    std::fill(opp,opp + CHUNK,board.bits[3 - board.cur_player]);
+    double wins = 0;
+    for(int first=0;first<mcts_rollouts;first+=CHUNK){
+        int n = std::min(CHUNK,mcts_rollouts - first);
+        playouts(me,opp,n,rng,margins);
+        for(int i=0;i<n;i++){
+            wins += margins[i] > 0 ? 1 : margins[i] == 0 ? 0.5 : 0;
+        }
+    }
+    return wins / mcts_rollouts;
+}
+// gives node, on board, its children; false if another thread is at it or
+// the pool is full. best is the node's value for its side to move, the best
+// of its children's.
+template<class Eval>
+bool mcts_expand(int node , const OthelloBoard& board , double& best){
+    int count = board.next_valid_spots.size();
+    if(mcts.used + count > (int)mcts.move.size()){
+        return false;
+    }
+    int expected = MCTS_LEAF;
+    if(!mcts.state[node].compare_exchange_strong(expected,MCTS_EXPANDING)){
+        return false;
+    }
+    int first = mcts.used.fetch_add(count);
+    if(first + count > (int)mcts.move.size()){
+        mcts.state[node] = MCTS_LEAF;
+        return false;
+    }
+    const int side = board.cur_player;
+    double logit[64], top = -1e300, sum = 0;
+    best = 0;
+    for(int i=0;i<count;i++){
+        Point p = board.next_valid_spots[i];
+        OthelloBoard child(board);
+        child.put_disc(p);
+        mcts_clear(first + i,p.x * 8 + p.y);
+        double evaluation;
+        if(child.done){
+            mcts.init[first + i] = mcts_result(child,side);
+            evaluation = (mcts.init[first + i] - 0.5) * 16 * MCTS_VALUE_SCALE;
+        }
+        else{
+            evaluation = Eval::evaluate(child) * (side == player ? 1 : -1);
+            mcts.init[first + i] = mcts_sigmoid(evaluation);
+        }
+        best = std::max(best,(double)mcts.init[first + i]);
+        logit[i] = evaluation / MCTS_PRIOR_SCALE;
+        top = std::max(top,logit[i]);
+    }
+    for(int i=0;i<count;i++){
+        logit[i] = std::exp(logit[i] - top);
+        sum += logit[i];
+    }
+    for(int i=0;i<count;i++){
+        mcts.prior[first + i] = logit[i] / sum;
+    }
+    mcts.first_child[node] = first;
+    mcts.child_count[node] = count;
+    mcts.state[node].store(MCTS_EXPANDED,std::memory_order_release);
+    return true;
+}
+// the child of node with the best PUCT score
+int mcts_select(int node){
+    const int first = mcts.first_child[node], last = first + mcts.child_count[node];
+    const double explore = MCTS_C * std::sqrt((double)mcts.visits[node]);
+    int pick = first;
+    double best = -1;
+    for(int c=first;c<last;c++){
+        int n = mcts.visits[c];
+        double q = ((double)mcts.value[c] / MCTS_ONE + mcts.init[c]) / (n + 1);
+        double u = q + explore * mcts.prior[c] / (1 + n);
+        if(u > best){
+            best = u;
+            pick = c;
+        }
+    }
+    return pick;
+}
+// one descent from the root, expanding the leaf it ends in
+template<class Eval>
+void mcts_playout(){
+    OthelloBoard board(mcts.root_board);
+    int path[64], movers[64], n = 0, node = mcts.root;
+    mcts.visits[node]++;
+    while(!board.done && mcts.state[node].load(std::memory_order_acquire) == MCTS_EXPANDED){
+        node = mcts_select(node);
+        mcts.visits[node]++;
+        path[n] = node;
+        movers[n++] = board.cur_player;
+        board.put_disc(mcts_point(node));
+    }
+    // win probability for player
+    double v, best;
+    if(board.done){
+        v = mcts_result(board,player);
+    }
+    else if(mcts_expand<Eval>(node,board,best) && !mcts_rollouts){
+        v = board.cur_player == player ? best : 1 - best;
+    }
+    else if(mcts_rollouts){
+        v = mcts_rollout(board);
+        v = board.cur_player == player ? v : 1 - v;
+    }
+    else{
+        v = mcts_sigmoid(Eval::evaluate(board));
+    }
+    const long long win = llround(v * MCTS_ONE);
+    for(int i=0;i<n;i++){
+        mcts.value[path[i]] += movers[i] == player ? win : MCTS_ONE - win;
+    }
+    mcts.playouts++;
+}
+// playouts from the root on mcts_threads threads, until playouts (0 for no
+// limit) or stop_search
+template<class Eval>
+void mcts_search(long long playouts){
+    mcts.playouts = 0;
+    auto work = [playouts](){
+        while(!stop_search && (playouts == 0 || mcts.playouts < playouts)){
+            mcts_playout<Eval>();
+        }
+    };
+    std::vector<std::thread> helpers;
+    for(int t=1;t<mcts_threads;t++){
+        helpers.emplace_back(work);
+    }
+    work();
+    for(auto& h:helpers){
+        h.join();
+    }
+}
+// mcts_search with the evaluator picked at startup
+void mcts_search(long long playouts){
+    switch(evaluator){
+        case EVAL_PATTERNS: return mcts_search<PatternEval>(playouts);
+        case EVAL_PASS_THREE: return mcts_search<PassThreeEval>(playouts);
+        case EVAL_TEMP: return mcts_search<TempEval>(playouts);
+        case EVAL_AC: return mcts_search<AcEval>(playouts);
+        case EVAL_THREE: return mcts_search<ThreeEval>(playouts);
+        case EVAL_NNUE: return mcts_search<NnueEval>(playouts);
+        default: return mcts_search<PhaseEval>(playouts);
+    }
+}
+// the most visited child of node, -1 for a leaf
+int mcts_best(int node){
+    if(mcts.state[node] != MCTS_EXPANDED){
+        return -1;
+    }
+    int pick = -1;
+    for(int c=mcts.first_child[node];c<mcts.first_child[node] + mcts.child_count[node];c++){
+        if(pick < 0 || mcts.visits[c] > mcts.visits[pick]){
+            pick = c;
+        }
+    }
+    return pick;
+}
+// sets cur.played_disc by a search of playouts playouts, and prints
+// info playouts <p> nodes <n> winrate <percent> pv <x> <y> ...
+void mcts_move(OthelloBoard& cur , long long playouts){
+    mcts_set_root(cur);
+    mcts_search(playouts);
+    int best = mcts_best(mcts.root);
+    if(best < 0){
+        return;
+    }
+    cur.played_disc = mcts_point(best);
+    *info << "info playouts " << mcts.playouts << " nodes " << mcts.used << " winrate " << \
+    100.0 * mcts.value[best] / MCTS_ONE / std::max(1,(int)mcts.visits[best]) << " pv";
+    for(int node=best;node >= 0;node=mcts_best(node)){
+        *info << " " << mcts_point(node).x << " " << mcts_point(node).y;
+    }
+    *info << endl;
+}
+// player 1 -> x  // player 2 -> o
+// node_budget > 0 -> iterative deepening until the budget is spent, the move
+// of the last finished depth is played, so the result never depends on timing.
+// Otherwise the search deepens to depth, stop_search ends it early with the
+// move of the last finished depth.
+// a solve that stop_search ended leaves no time for the normal search, the
+// move comes from a search this deep instead, which takes next to nothing
+// at ENDGAME_EMPTIES
+const int STOPPED_SOLVE_DEPTH = 3;
+Point choose_move(const GameState& state , long long node_budget = 0 , int depth = 5) {
+    player = state.player;
+    OthelloBoard cur(state.next_valid_spots,state.board,player);
+    cur.played_disc = cur.next_valid_spots[0];
+    std::vector<RootLine> lines;
+    nodes = 0;
+    node_limit = node_budget;
+    bool solving = cur.disc_count[0] <= ENDGAME_EMPTIES;
+    if(solving && solve_root(cur,lines)){
+        // solved, the score is the final disc difference
+    }
+    else if(solving && stop_search){
+        nodes = 0;
+        node_limit = 0;
+        stop_ignored = true;
+        deepen(cur,0,STOPPED_SOLVE_DEPTH,lines);
+        stop_ignored = false;
+    }
+    else if(mcts_threads > 0){
+        nodes = 0;
+        mcts_move(cur,node_limit == 0 ? MCTS_PLAYOUTS : node_limit);
+    }
+    else{
+        // an unfinished solve leaves the whole budget to the normal search
+        nodes = 0;
+        deepen(cur,0,node_limit == 0 ? depth : cur.disc_count[0],lines);
+    }
+    print_eval_cache();
+    return cur.played_disc;
+}
+
+void write_valid_spot(const GameState& state , std::ofstream& fout , long long node_budget = 0) {
+    Point move = choose_move(state,node_budget);
+    *info << move.x << " " << move.y << std::endl;
+    fout << move.x << " " << move.y << std::endl;
+    fout.flush();
+}
+// pondering: while the opponent thinks, the position after its predicted
+// reply (the second move of our principal variation) is searched in the
+// background. ponder_depth is the deepest depth it finished, -1 for none.
+OthelloBoard ponder_board;
+std::vector<RootLine> ponder_lines;
+int ponder_depth = -1;
+std::thread ponder_thread;
+
+void start_pondering(const OthelloBoard& cur , const std::vector<RootLine>& lines){
+    ponder_depth = -1;
+    ponder_lines.clear();
+    OthelloBoard next = play_move(cur,cur.played_disc);
+    // the tree search ponders every reply, its tree keeps the work
+    if(mcts_threads > 0){
+        if(!next.done){
+            mcts_set_root(next);
+            ponder_thread = std::thread([](){
+                mcts_search(0);
+            });
+        }
+        return;
+    }
+    if(!next.done && next.cur_player != player){
+        Point reply = next.next_valid_spots[0];
+        if(!lines.empty() && lines[0].pv.size() > 1){
+            reply = lines[0].pv[1];
+        }
+        next = play_move(next,reply);
+    }
+    if(next.done || next.cur_player != player){
+        return;
+    }
+    ponder_board = next;
+    ponder_board.played_disc = ponder_board.next_valid_spots[0];
+    nodes = 0;
+    node_limit = 0;
+    ponder_thread = std::thread([](){
+        ponder_depth = deepen(ponder_board,0,ponder_board.disc_count[0],ponder_lines);
+    });
+}
+
+void stop_pondering(){
+    if(ponder_thread.joinable()){
+        stop_search = true;
+        ponder_thread.join();
+        stop_search = false;
+    }
+}
+
+// persistent mode: states arrive on stdin in the format of the state file
+// and every move is answered on stdout. On a ponder hit the search goes on
+// from the depth the ponder reached, on a miss it starts over with the
+// transposition table the ponder filled.
+void ponder_loop(int depth){
+    info = &cerr;
+    while(cin >> std::ws && cin.peek() != EOF){
+        stop_pondering();
+        GameState state;
+        read_board(cin,state);
+        read_valid_spots(cin,state);
+        player = state.player;
+        OthelloBoard cur(state.next_valid_spots,state.board,player);
+        cur.played_disc = cur.next_valid_spots[0];
+        std::vector<RootLine> lines;
+        int first = 0;
+        if(ponder_depth >= 0 && ponder_board.key() == cur.key()){
+            *info << "ponder hit depth " << ponder_depth << endl;
+            cur.played_disc = ponder_board.played_disc;
+            lines = ponder_lines;
+            first = ponder_depth + 1;
+        }
+        nodes = 0;
+        node_limit = 0;
+        if(cur.disc_count[0] <= ENDGAME_EMPTIES && solve_root(cur,lines)){
+            // solved
+        }
+        else if(mcts_threads > 0){
+            mcts_move(cur,MCTS_PLAYOUTS);
+        }
+        else{
+            deepen(cur,first,depth,lines);
+        }
+        print_eval_cache();
+        cout << cur.played_disc.x << " " << cur.played_disc.y << std::endl;
+        start_pondering(cur,lines);
+    }
+    stop_pondering();
+}
+
+// the tools define MY_PROJECT_NO_MAIN and include this file for the engine
+#ifndef MY_PROJECT_NO_MAIN
+// usage: my_project <state> <action> [node budget] [multipv]
+//        MY_PROJECT_TT=<file> keeps the transposition table between moves
+//        MY_PROJECT_ENDGAME=<file> keeps solved endgames, see endgame_init
+//        MY_PROJECT_PATTERNS=<file>|builtin evaluates by patterns
+//        MY_PROJECT_EVAL=phase|patterns|pass_three|temp|ac|three|nnue picks the evaluator
+//        MY_PROJECT_NNUE=<file> holds the network of nnue
+//        MY_PROJECT_EVAL_CACHE=<bits> sizes the evaluation cache, 0 disables it
+//        MY_PROJECT_MCTS=<threads> plays by Monte Carlo tree search
+//        MY_PROJECT_MCTS_ROLLOUTS=<n> values its leaves by n random playouts
+//        my_project --ponder [depth]    (persistent process, see ponder_loop)
+int main(int argc, char** argv) {
+    tt_init();
+    endgame_init();
+    evaluator_init();
+    if(evaluator == EVAL_PATTERNS){
+        pattern_init();
+    }
+    if(evaluator == EVAL_NNUE){
+        nnue_init();
+    }
+    eval_cache_init();
+    mcts_init();
+    if(argc > 1 && std::string(argv[1]) == "--ponder"){
+        ponder_loop(argc > 2 ? atoi(argv[2]) : 5);
+        return 0;
+    }
+    std::ifstream fin(argv[1]);
+    std::ofstream fout(argv[2]);
+    long long node_budget = argc > 3 ? atoll(argv[3]) : 0;
+    if(argc > 4){
+        multipv = std::max(1,atoi(argv[4]));
+    }
+    GameState state;
+    read_board(fin,state);
+    read_valid_spots(fin,state);
+    write_valid_spot(state,fout,node_budget);
+    fin.close();
+    fout.close();
+    return 0;
+}
+#endif
\ No newline at end of file
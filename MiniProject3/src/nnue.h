@@ -0,0 +1,32 @@
+// Layout and quantisation of the NNUE evaluator, shared by my_project and
+// the tools that train it. The weights live in a weights file
+// (weights_format.h) as the sections below.
+//
+//   acc  = b1 + the w1 rows of every disc on the board, one row per
+//          (colour, square); my_project keeps it up to date disc by disc
+//   h    = clamp(acc, 0, NNUE_ONE)
+//   out  = b2[side] + h . w2[side], side = side to move - 1
+//
+// out / (NNUE_ONE * NNUE_W2_ONE) is the final disc difference for black
+// divided by NNUE_DISCS.
+#ifndef NNUE_H
+#define NNUE_H
+
+const int NNUE_INPUTS = 128;
+const int NNUE_HIDDEN = 32;
+// the accumulator value of an activation of 1.0, and the w2 value of 1.0
+const int NNUE_ONE = 127;
+const int NNUE_W2_ONE = 64;
+const int NNUE_DISCS = 16;
+
+const char NNUE_W1[] = "nnue.w1";   // i16 [NNUE_INPUTS][NNUE_HIDDEN]
+const char NNUE_B1[] = "nnue.b1";   // i16 [NNUE_HIDDEN]
+const char NNUE_W2[] = "nnue.w2";   // i8  [2][NNUE_HIDDEN]
+const char NNUE_B2[] = "nnue.b2";   // i32 [2]
+
+// input of a disc of colour (1 black, 2 white) on square x * 8 + y
+inline int nnue_feature(int colour , int sq){
+    return (colour - 1) * 64 + sq;
+}
+
+#endif
@@ -0,0 +1,312 @@
+// Trains the NNUE evaluator (nnue.h) on a dataset (dataset.h) and writes
+// the quantised network as a weights file for MY_PROJECT_NNUE.
+// usage: ./nnue_train <dataset> <out> [epochs] [threads] [buffer]
+//
+// The dataset is streamed: records pass through a shuffle buffer of
+// buffer records (1M by default), so memory does not grow with the file.
+// Every batch is split between a pool of threads kept for the whole run,
+// each one runs the forward and backward passes of its slice into its own
+// gradient, and Adam applies their sum. The hidden layer loops are fixed length float loops, built
+// for AVX2 and for plain x86-64 where the compiler supports target_clones.
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <random>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include "weights_format.h"
+#include "nnue.h"
+#include "dataset.h"
+
+#if defined(__GNUC__) && defined(__x86_64__) && defined(__linux__)
+#define TRAIN_KERNEL __attribute__((target_clones("avx2","default")))
+#else
+#define TRAIN_KERNEL
+#endif
+
+using namespace std;
+const int BATCH = 4096;
+const int CHUNK = 65536;
+const float LEARNING_RATE = 0.001f;
+// float weights beyond these can't be quantised: the int16 accumulator holds
+// b1 plus the w1 of up to 64 discs, the output weights are int8. They are
+// kept within the limits during training, so the shipped network is the
+// trained one.
+constexpr float W1_LIMIT = 2.0f;
+constexpr float B1_LIMIT = 1.0f;
+const float W2_LIMIT = 127.0f / NNUE_W2_ONE;
+static_assert((B1_LIMIT + 64 * W1_LIMIT) * NNUE_ONE + 65 <= 32767,"the quantised accumulator must fit an int16");
+
+// the network in floats, an activation of 1.0 is NNUE_ONE in the engine
+struct Network {
+    float w1[NNUE_INPUTS][NNUE_HIDDEN];
+    float b1[NNUE_HIDDEN];
+    float w2[2][NNUE_HIDDEN];
+    float b2[2];
+};
+const int PARAMS = sizeof(Network) / sizeof(float);
+
+int features(const PositionRecord& r , int* f){
+    int n = 0;
+    for(int sq=0;sq<64;sq++){
+        if((r.black >> sq) & 1){
+            f[n++] = nnue_feature(1,sq);
+        }
+        else if((r.white >> sq) & 1){
+            f[n++] = nnue_feature(2,sq);
+        }
+    }
+    return n;
+}
+// adds the gradient of the squared error of n records to grad, returns the
+// summed squared error. The target is result / NNUE_DISCS.
+TRAIN_KERNEL
+double train_slice(const Network& net , const PositionRecord* r , int n , Network& grad){
+    double loss = 0;
+    int f[64];
+    for(int k=0;k<n;k++){
+        int count = features(r[k],f), side = r[k].side - 1;
+        float acc[NNUE_HIDDEN], h[NNUE_HIDDEN];
+        for(int i=0;i<NNUE_HIDDEN;i++){
+            acc[i] = net.b1[i];
+        }
+        for(int j=0;j<count;j++){
+            for(int i=0;i<NNUE_HIDDEN;i++){
+                acc[i] += net.w1[f[j]][i];
+            }
+        }
+        float y = net.b2[side];
+        for(int i=0;i<NNUE_HIDDEN;i++){
+            h[i] = std::min(1.0f,std::max(0.0f,acc[i]));
+            y += h[i] * net.w2[side][i];
+        }
+        float err = y - (float)r[k].result / NNUE_DISCS;
+        loss += err * err;
+        float dy = 2 * err;
+        grad.b2[side] += dy;
+        float dacc[NNUE_HIDDEN];
+        for(int i=0;i<NNUE_HIDDEN;i++){
+            grad.w2[side][i] += dy * h[i];
+            dacc[i] = acc[i] > 0 && acc[i] < 1 ? dy * net.w2[side][i] : 0;
+            grad.b1[i] += dacc[i];
+        }
+        for(int j=0;j<count;j++){
+            for(int i=0;i<NNUE_HIDDEN;i++){
+                grad.w1[f[j]][i] += dacc[i];
+            }
+        }
+    }
+    return loss;
+}
+class Trainer {
+public:
+    Trainer(int threads) : threads(threads), grads(threads), loss(threads), m(PARAMS,0), v(PARAMS,0), steps(0) {
+        std::mt19937 rng(2021);
+        std::uniform_real_distribution<float> small(-0.05f,0.05f);
+        for(auto& row:net.w1){
+            for(auto& w:row){
+                w = small(rng);
+            }
+        }
+        for(auto& b:net.b1){
+            b = 0.25f;
+        }
+        for(auto& row:net.w2){
+            for(auto& w:row){
+                w = small(rng) * 2;
+            }
+        }
+        net.b2[0] = net.b2[1] = 0;
+        for(int t=0;t<threads;t++){
+            pool.emplace_back(&Trainer::work,this,t);
+        }
+    }
+    ~Trainer(){
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            quit = true;
+        }
+        start.notify_all();
+        for(auto& th:pool){
+            th.join();
+        }
+    }
+    // one Adam step on a batch, returns its summed squared error
+    double step(const std::vector<PositionRecord>& batch){
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            current = &batch;
+            running = threads;
+            round++;
+        }
+        start.notify_all();
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done.wait(lock,[&](){ return running == 0; });
+        }
+        steps++;
+        const float beta1 = 0.9f, beta2 = 0.999f, eps = 1e-8f;
+        const float correction = std::sqrt(1 - std::pow(beta2,steps)) / (1 - std::pow(beta1,steps));
+        float* w = reinterpret_cast<float*>(&net);
+        for(int p=0;p<PARAMS;p++){
+            float g = 0;
+            for(int t=0;t<threads;t++){
+                g += reinterpret_cast<const float*>(&grads[t])[p];
+            }
+            g /= batch.size();
+            m[p] = beta1 * m[p] + (1 - beta1) * g;
+            v[p] = beta2 * v[p] + (1 - beta2) * g * g;
+            w[p] -= LEARNING_RATE * correction * m[p] / (std::sqrt(v[p]) + eps);
+        }
+        for(auto& row:net.w1){
+            for(auto& x:row){
+                x = std::max(-W1_LIMIT,std::min(W1_LIMIT,x));
+            }
+        }
+        for(auto& x:net.b1){
+            x = std::max(-B1_LIMIT,std::min(B1_LIMIT,x));
+        }
+        for(auto& row:net.w2){
+            for(auto& x:row){
+                x = std::max(-W2_LIMIT,std::min(W2_LIMIT,x));
+            }
+        }
+        double sum = 0;
+        for(double l:loss){
+            sum += l;
+        }
+        return sum;
+    }
+    bool save(const std::string& path) const {
+        std::vector<short> w1(NNUE_INPUTS * NNUE_HIDDEN), b1(NNUE_HIDDEN);
+        std::vector<signed char> w2(2 * NNUE_HIDDEN);
+        std::vector<int> b2(2);
+        for(int f=0;f<NNUE_INPUTS;f++){
+            for(int i=0;i<NNUE_HIDDEN;i++){
+                w1[f * NNUE_HIDDEN + i] = (short)lround(net.w1[f][i] * NNUE_ONE);
+            }
+        }
+        for(int i=0;i<NNUE_HIDDEN;i++){
+            b1[i] = (short)lround(net.b1[i] * NNUE_ONE);
+            for(int s=0;s<2;s++){
+                w2[s * NNUE_HIDDEN + i] = (signed char)lround(net.w2[s][i] * NNUE_W2_ONE);
+            }
+        }
+        for(int s=0;s<2;s++){
+            b2[s] = (int)lround((double)net.b2[s] * NNUE_ONE * NNUE_W2_ONE);
+        }
+        std::ofstream out(path,std::ios::binary);
+        return weights_write(out,{
+            WeightsBlob{NNUE_W1,WEIGHT_I16,w1.size(),w1.data()},
+            WeightsBlob{NNUE_B1,WEIGHT_I16,b1.size(),b1.data()},
+            WeightsBlob{NNUE_W2,WEIGHT_I8,w2.size(),w2.data()},
+            WeightsBlob{NNUE_B2,WEIGHT_I32,b2.size(),b2.data()}
+        });
+    }
+private:
+    // a pool thread: its slice of every batch step hands out
+    void work(int t){
+        long long seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        while(true){
+            start.wait(lock,[&](){ return quit || round != seen; });
+            if(quit){
+                return;
+            }
+            seen = round;
+            const std::vector<PositionRecord>& batch = *current;
+            lock.unlock();
+            grads[t] = Network();
+            int per = (batch.size() + threads - 1) / threads;
+            int first = std::min((int)batch.size(),t * per), last = std::min((int)batch.size(),first + per);
+            loss[t] = train_slice(net,batch.data() + first,last - first,grads[t]);
+            lock.lock();
+            if(--running == 0){
+                done.notify_one();
+            }
+        }
+    }
+    Network net;
+    int threads;
+    std::vector<Network> grads;
+    std::vector<double> loss;
+    std::vector<std::thread> pool;
+    std::mutex mutex;
+    std::condition_variable start, done;
+    const std::vector<PositionRecord>* current = nullptr;
+    long long round = 0;
+    int running = 0;
+    bool quit = false;
+    // Adam moments
+    std::vector<float> m, v;
+    int steps;
+};
+
+int main(int argc, char** argv){
+    if(argc < 3){
+        cerr << "usage: " << argv[0] << " <dataset> <out> [epochs] [threads] [buffer]" << endl;
+        return 1;
+    }
+    int epochs = argc > 3 ? std::max(1,atoi(argv[3])) : 10;
+    int threads = argc > 4 ? std::max(1,atoi(argv[4])) : std::max(1u,std::thread::hardware_concurrency());
+    size_t capacity = argc > 5 ? std::max(1LL,atoll(argv[5])) : 1 << 20;
+    Trainer trainer(threads);
+    std::mt19937_64 rng(7);
+    std::vector<PositionRecord> chunk(CHUNK), pool, batch;
+    pool.reserve(capacity);
+    batch.reserve(BATCH);
+    for(int epoch=1;epoch<=epochs;epoch++){
+        auto start = std::chrono::steady_clock::now();
+        DatasetReader reader;
+        if(!reader.open(argv[1])){
+            cerr << "can't read dataset " << argv[1] << endl;
+            return 1;
+        }
+        double loss = 0;
+        long long seen = 0;
+        auto feed = [&](const PositionRecord& r){
+            batch.push_back(r);
+            if((int)batch.size() == BATCH){
+                loss += trainer.step(batch);
+                seen += batch.size();
+                batch.clear();
+            }
+        };
+        // a record entering a full buffer pushes out a random one
+        pool.clear();
+        size_t n;
+        while((n = reader.read(chunk.data(),CHUNK)) > 0){
+            for(size_t k=0;k<n;k++){
+                if(pool.size() < capacity){
+                    pool.push_back(chunk[k]);
+                    continue;
+                }
+                size_t j = rng() % capacity;
+                feed(pool[j]);
+                pool[j] = chunk[k];
+            }
+        }
+        std::shuffle(pool.begin(),pool.end(),rng);
+        for(auto& r:pool){
+            feed(r);
+        }
+        if(!batch.empty()){
+            loss += trainer.step(batch);
+            seen += batch.size();
+            batch.clear();
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        cout << "epoch " << epoch << " positions " << seen << " rmse " << \
+        (seen ? std::sqrt(loss / seen) * NNUE_DISCS : 0) << " discs " << seconds << " s" << endl;
+    }
+    if(!trainer.save(argv[2])){
+        cerr << "can't write " << argv[2] << endl;
+        return 1;
+    }
+    return 0;
+}
@@ -30,6 +30,15 @@ struct Point {
 		return Point(x - rhs.x, y - rhs.y);
 	}
 };
+// bit i*8+j of a mask is the square (i,j)
+const unsigned long long COL_0 = 0x0101010101010101ULL;
+const unsigned long long COL_7 = 0x8080808080808080ULL;
+// squares next to a square of b in any of the 8 directions
+unsigned long long neighbours(unsigned long long b){
+    unsigned long long left = (b >> 1) & ~COL_7, right = (b << 1) & ~COL_0;
+    unsigned long long row = b | left | right;
+    return left | right | (row >> 8) | (row << 8);
+}
 
 
 class OthelloBoard {
@@ -226,34 +235,30 @@ public:
             -3, -7, -4, 1, 1, -4, -7, -3,
              20, -3, 11, 8, 8, 11, -3, 20,
         };
-        double p = 0, c = 0, l = 0, m = 0, f = 0, d = 0;
+        double p = 0, c = 0, l = 0, m = 0, f = 0, d = 0, pm = 0;
+        unsigned long long mine = 0, opp = 0;
         // p ->piece difference 
         for(int i=0;i<SIZE;i++){
             for(int j=0;j<SIZE;j++){
                 if(input.board[i][j] == player){
                     d += price[i][j];
                     my_tiles ++ ;
+                    mine |= 1ULL << (i*SIZE+j);
                 }
                 else if(input.board[i][j] == 3- player){
                     d -= price[i][j];
                     opp_tiles ++ ;
-                }
-                else{
-                    for(int k=0;k<8;k++){
-                        if(i+directions[k].x >= 0 && i+directions[k].x < 8 && j+directions[k].y >= 0 && j+directions[k].y < 8){
-                            if(input.board[i+directions[k].x][j+directions[k].y] == player ){
-                                my_front_tiles ++;
-                                break;
-                            }
-                            else if(input.board[i+directions[k].x][j+directions[k].y] == 3-player){
-                                opp_front_tiles ++; 
-                                break;
-                            }
-                        }
-                    }
+                    opp |= 1ULL << (i*SIZE+j);
                 }
             }
         }
+        // frontier discs touch an empty square, potential mobility counts
+        // the empty squares next to the other side's discs
+        unsigned long long empty = ~(mine | opp);
+        my_front_tiles = __builtin_popcountll(mine & neighbours(empty));
+        opp_front_tiles = __builtin_popcountll(opp & neighbours(empty));
+        double my_potential = __builtin_popcountll(empty & neighbours(opp));
+        double opp_potential = __builtin_popcountll(empty & neighbours(mine));
         if(my_tiles > opp_tiles){
             p = (my_tiles)*100/(my_tiles + opp_tiles);
         }
@@ -268,6 +273,9 @@ public:
             f = (opp_front_tiles)*100/(my_front_tiles + opp_front_tiles);
         }
         else f = 0;
+        if(my_potential + opp_potential > 0){
+            pm = 100.0 * (my_potential - opp_potential) / (my_potential + opp_potential);
+        }
         
 
         // corner occupation
@@ -330,7 +338,7 @@ public:
 		    m = -(100.0 * opp_tiles)/(my_tiles + opp_tiles);
 	    else m = 0;
         //cout << "m is " << m <<endl;
-        heu  = (2 * p) + (20 * c) + (12 * l) + (15 * m) + (-5 * f) + (20 * d);
+        heu  = (2 * p) + (20 * c) + (12 * l) + (15 * m) + (-5 * f) + (20 * d) + (5 * pm);
         return heu;
     }
     
@@ -0,0 +1,40 @@
+// Checks that the builtin pattern weights add back up to the price table
+// they split across the patterns (symmetric_price), on random positions.
+// Exits with 1 on a position where they don't.
+// usage: ./pattern_check [positions] [seed]
+//
+// Each instance's weight is rounded to 1 / PATTERN_SCALE and the sum is
+// truncated to EVAL_SCALE units, so the two may differ by that much.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include <random>
+
+int main(int argc, char** argv){
+    int positions = argc > 1 ? std::max(1,atoi(argv[1])) : 10000;
+    std::mt19937 rng(argc > 2 ? atoi(argv[2]) : 1);
+    pattern_builtin_weights();
+    pattern_table = pattern_weights.data();
+    const double tolerance = PATTERN_INSTANCES * 0.5 / PATTERN_SCALE + 1.0 / EVAL_SCALE;
+    double worst = 0;
+    for(int n=0;n<positions;n++){
+        OthelloBoard board;
+        int plies = rng() % 60;
+        for(int i=0;i<plies && !board.done;i++){
+            board.put_disc(board.next_valid_spots[rng() % board.next_valid_spots.size()]);
+        }
+        player = OthelloBoard::BLACK;
+        double expected = 0;
+        for(int sq=0;sq<64;sq++){
+            int d = board.board[sq / 8][sq % 8];
+            expected += d == OthelloBoard::BLACK ? symmetric_price(sq) : d == OthelloBoard::WHITE ? -symmetric_price(sq) : 0;
+        }
+        double got = (double)board.pattern_heuristic() / EVAL_SCALE;
+        worst = std::max(worst,std::fabs(got - expected));
+        if(std::fabs(got - expected) > tolerance){
+            cout << "position " << n << ": price " << expected << " patterns " << got << endl;
+            return 1;
+        }
+    }
+    cout << positions << " positions, largest difference " << worst << " (tolerance " << tolerance << ")" << endl;
+    return 0;
+}
@@ -0,0 +1,44 @@
+// The C interface of a player built as a shared library, for the referee's
+// "lib:<path>" players (main.cpp). player_lib.cpp implements it with the
+// engine of my_project.cpp.
+//
+// The referee calls init once per player and game, choose once per move
+// and shutdown at the end, all from one thread. stop may come from another
+// thread while choose runs: the player should then answer at once with the
+// best move it has. A stop that comes just after choose returned is to be
+// ignored.
+#ifndef PLAYER_ABI_H
+#define PLAYER_ABI_H
+
+#define OTHELLO_PLAYER_ABI_VERSION 1
+
+#if defined(__GNUC__)
+#define OTHELLO_PLAYER_EXPORT __attribute__((visibility("default")))
+#else
+#define OTHELLO_PLAYER_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct OthelloPlayer OthelloPlayer;
+
+// a new player, NULL when the library can't serve abi_version
+OTHELLO_PLAYER_EXPORT OthelloPlayer* othello_player_init(int abi_version);
+// state is the content of a state file. The move goes to x and y within
+// time_limit_ms milliseconds; 0 on success.
+OTHELLO_PLAYER_EXPORT int othello_player_choose(OthelloPlayer* player, const char* state, int time_limit_ms, int* x, int* y);
+OTHELLO_PLAYER_EXPORT void othello_player_stop(OthelloPlayer* player);
+OTHELLO_PLAYER_EXPORT void othello_player_shutdown(OthelloPlayer* player);
+
+typedef OthelloPlayer* (*othello_player_init_fn)(int);
+typedef int (*othello_player_choose_fn)(OthelloPlayer*, const char*, int, int*, int*);
+typedef void (*othello_player_stop_fn)(OthelloPlayer*);
+typedef void (*othello_player_shutdown_fn)(OthelloPlayer*);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,109 @@
+// my_project as a shared library player (player_abi.h), for the referee's
+// "lib:./player_lib.so" players. Built by the makefile as player_lib.so.
+//
+// The engine keeps its tables and search state in globals, so every player
+// of the process shares them: the tables are set up by the first init and
+// the searches of all players run one at a time under engine_mutex. That
+// is all the referee needs, it asks the players in turn. Each search
+// deepens until its own timer, at TIME_SHARE of the time limit, or the
+// referee's stop ends it, and answers with the last finished depth.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include "player_abi.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+const double TIME_SHARE = 0.8;
+const int MAX_DEPTH = 64;
+
+// the engine state is shared, a player only tells whose search to stop
+struct OthelloPlayer {
+};
+
+std::once_flag engine_ready;
+std::mutex engine_mutex;
+// guards searching and the stop_search of its search
+std::mutex stop_mutex;
+OthelloPlayer* searching = nullptr;
+std::ostream quiet(nullptr);
+
+void init_engine(){
+    tt_init();
+    endgame_init();
+    evaluator_init();
+    if(evaluator == EVAL_PATTERNS){
+        pattern_init();
+    }
+    if(evaluator == EVAL_NNUE){
+        nnue_init();
+    }
+    eval_cache_init();
+    mcts_init();
+    info = &quiet;
+}
+
+extern "C" {
+
+OthelloPlayer* othello_player_init(int abi_version){
+    if(abi_version != OTHELLO_PLAYER_ABI_VERSION){
+        return nullptr;
+    }
+    std::call_once(engine_ready,init_engine);
+    return new OthelloPlayer();
+}
+
+void othello_player_stop(OthelloPlayer* player){
+    std::lock_guard<std::mutex> lock(stop_mutex);
+    if(searching == player){
+        stop_search = true;
+    }
+}
+
+int othello_player_choose(OthelloPlayer* player, const char* state, int time_limit_ms, int* x, int* y){
+    GameState game;
+    std::istringstream in(state);
+    read_board(in,game);
+    read_valid_spots(in,game);
+    if(!in || game.next_valid_spots.empty()){
+        return 1;
+    }
+    std::lock_guard<std::mutex> engine(engine_mutex);
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex);
+        searching = player;
+        stop_search = false;
+    }
+    // the timer stops the search early enough to answer in time
+    std::mutex timer_mutex;
+    std::condition_variable timer_cv;
+    bool done = false;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds((long long)(time_limit_ms * TIME_SHARE));
+    std::thread timer([&](){
+        std::unique_lock<std::mutex> lock(timer_mutex);
+        if(!timer_cv.wait_until(lock,deadline,[&](){ return done; })){
+            othello_player_stop(player);
+        }
+    });
+    Point move = choose_move(game,0,MAX_DEPTH);
+    {
+        std::lock_guard<std::mutex> lock(timer_mutex);
+        done = true;
+    }
+    timer_cv.notify_one();
+    timer.join();
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex);
+        searching = nullptr;
+        stop_search = false;
+    }
+    *x = move.x;
+    *y = move.y;
+    return 0;
+}
+
+void othello_player_shutdown(OthelloPlayer* player){
+    delete player;
+}
+
+}
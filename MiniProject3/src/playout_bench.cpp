@@ -0,0 +1,68 @@
+// Games per second of the random playout kernel, from the start position.
+// usage: ./playout_bench [games] [threads]
+//
+// The kernel games are split between the threads, each one with its own
+// generator, and played through the batched playouts in chunks of BATCH.
+// For reference a few random games are also played by put_disc on an
+// OthelloBoard, the way the rest of the engine plays moves.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include <chrono>
+
+const int BATCH = 64;
+
+double seconds_since(std::chrono::steady_clock::time_point start){
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char** argv){
+    long long games = argc > 1 ? std::max(1LL,atoll(argv[1])) : 1000000;
+    int threads = argc > 2 ? std::max(1,atoi(argv[2])) : std::max(1u,std::thread::hardware_concurrency());
+    OthelloBoard start;
+    std::vector<long long> wins(threads,0), draws(threads,0);
+    auto begin = std::chrono::steady_clock::now();
+    std::vector<std::thread> pool;
+    for(int t=0;t<threads;t++){
+        pool.emplace_back([&,t](){
+            Xorshift rng(t + 1);
+            unsigned long long me[BATCH], opp[BATCH];
+            int margins[BATCH];
+            std::fill(me,me + BATCH,start.bits[OthelloBoard::BLACK]);
+            std::fill(opp,opp + BATCH,start.bits[OthelloBoard::WHITE]);
+            long long mine = games / threads + (t < games % threads);
+            for(long long first=0;first<mine;first+=BATCH){
+                int n = std::min((long long)BATCH,mine - first);
+                playouts(me,opp,n,rng,margins);
+                for(int i=0;i<n;i++){
+                    wins[t] += margins[i] > 0;
+                    draws[t] += margins[i] == 0;
+                }
+            }
+        });
+    }
+    for(auto& th:pool){
+        th.join();
+    }
+    double kernel = seconds_since(begin);
+    long long black = 0, drawn = 0;
+    for(int t=0;t<threads;t++){
+        black += wins[t];
+        drawn += draws[t];
+    }
+    cout << "playout " << games << " games " << threads << " threads " << kernel << " s " << \
+    (long long)(games / kernel) << " games/s, black wins " << 100.0 * black / games << "% draws " << \
+    100.0 * drawn / games << "%" << endl;
+
+    long long reference = std::max(1LL,games / 100);
+    Xorshift rng(1);
+    begin = std::chrono::steady_clock::now();
+    for(long long g=0;g<reference;g++){
+        OthelloBoard board(start);
+        while(!board.done){
+            board.put_disc(board.next_valid_spots[rng.next() % board.next_valid_spots.size()]);
+        }
+    }
+    double slow = seconds_since(begin);
+    cout << "put_disc " << reference << " games 1 thread " << slow << " s " << (long long)(reference / slow) << " games/s" << endl;
+    return 0;
+}
@@ -0,0 +1,93 @@
+// Checks that search_many scores positions the way search_root does, on
+// random positions: at each depth every position is searched once by
+// search_root and once as a SearchTask, the tasks side by side in one
+// search_many, with both sides to move among them. Exits with 1 on a
+// position where the scores differ.
+// usage: ./search_check [positions] [max depth] [seed]
+//
+// A table entry is only reused at its own remaining depth when the roots
+// that share the table have as many discs, otherwise a deeper entry of
+// another root may change a score. So the positions are searched in groups
+// of one disc count, with the transposition table cleared before each of
+// the two searches of a group.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include <map>
+#include <random>
+
+void tt_clear(){
+    std::fill(tt_heap.begin(),tt_heap.end(),TTSlot());
+}
+
+int main(int argc, char** argv){
+    int positions = argc > 1 ? std::max(1,atoi(argv[1])) : 200;
+    int max_depth = argc > 2 ? std::max(1,atoi(argv[2])) : 5;
+    std::mt19937 rng(argc > 3 ? atoi(argv[3]) : 1);
+    unsetenv("MY_PROJECT_TT");
+    tt_init();
+    evaluator_init();
+    if(evaluator == EVAL_PATTERNS){
+        pattern_init();
+    }
+    if(evaluator == EVAL_NNUE){
+        nnue_init();
+    }
+    eval_cache_init();
+    std::ostream quiet(nullptr);
+    info = &quiet;
+
+    // every position also with the other side to move, if it has a move
+    std::map<int,std::vector<OthelloBoard>> groups;
+    int drawn = 0;
+    while(drawn < positions){
+        OthelloBoard board;
+        int plies = rng() % 50;
+        for(int i=0;i<plies && !board.done;i++){
+            board.put_disc(board.next_valid_spots[rng() % board.next_valid_spots.size()]);
+        }
+        if(board.done){
+            continue;
+        }
+        std::vector<OthelloBoard>& group = groups[board.disc_count[OthelloBoard::EMPTY]];
+        group.push_back(board);
+        OthelloBoard other(board.next_valid_spots,board.board,3 - board.cur_player);
+        other.next_valid_spots = other.get_valid_spots();
+        if(!other.next_valid_spots.empty()){
+            group.push_back(other);
+        }
+        drawn++;
+    }
+    for(int depth=1;depth<=max_depth;depth++){
+        int searched = 0;
+        for(auto& g:groups){
+            std::vector<OthelloBoard>& boards = g.second;
+            std::vector<int> expected;
+            tt_clear();
+            for(auto& board:boards){
+                OthelloBoard cur(board);
+                std::vector<RootLine> lines;
+                player = cur.cur_player;
+                nodes = 0;
+                node_limit = 0;
+                deepen(cur,depth,depth,lines);
+                expected.push_back(lines[0].score);
+            }
+            tt_clear();
+            std::vector<SearchTask> tasks;
+            for(auto& board:boards){
+                tasks.emplace_back(board,board.cur_player,depth);
+            }
+            search_many(tasks);
+            for(size_t i=0;i<boards.size();i++){
+                if(tasks[i].score != expected[i]){
+                    cout << "depth " << depth << ", " << g.first << " empties, position " << i << ": search_root " << \
+                        expected[i] << " search_many " << tasks[i].score << endl;
+                    return 1;
+                }
+            }
+            searched += boards.size();
+        }
+        cout << "depth " << depth << ": " << searched << " positions agree" << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,234 @@
+// Plays the engine against itself and writes the positions as a dataset
+// (dataset.h) for tune and nnue_train.
+// usage: ./selfplay <out> [games] [depth] [workers] [random plies] [seed]
+//                   [games in flight]
+//
+// The engine keeps its tables in globals, so the workers are forked copies
+// of this process rather than threads. Each one plays every workers-th
+// game, games in flight of them at once: their fixed depth searches run
+// interleaved as SearchTasks, whose leaves are evaluated in shared batches,
+// and the last SELFPLAY_SOLVE_EMPTIES are solved exactly. The first random
+// plies of a game are random moves. A finished game goes to
+// the parent through a pipe in a single write, the parent drops positions
+// whose canonical key it has seen before and writes the rest.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include "dataset.h"
+#include <chrono>
+#include <climits>
+#include <functional>
+#include <random>
+#include <unordered_set>
+#ifdef HAVE_MMAP
+#include <sys/wait.h>
+#endif
+
+const int SELFPLAY_SOLVE_EMPTIES = 10;
+
+// a position as it travels from a worker to the parent
+struct GameRecord {
+    PositionRecord record;
+    unsigned long long key;
+};
+const int MAX_PLIES = 64;
+// a finished game, small enough for one atomic pipe write
+struct GameMessage {
+    int n;
+    GameRecord records[MAX_PLIES];
+};
+#ifdef HAVE_MMAP
+static_assert(sizeof(GameMessage) <= PIPE_BUF,"a game must fit one atomic pipe write");
+#endif
+typedef std::function<void(const GameMessage&)> GameSink;
+
+short clamp_score(long long score){
+    return (short)std::max((long long)-SHRT_MAX,std::min((long long)SHRT_MAX,score));
+}
+// a game in progress
+struct SelfplayGame {
+    unsigned int id;
+    std::mt19937_64 rng;
+    OthelloBoard cur;
+    int ply;
+    GameMessage m;
+};
+// the record of cur, scored for its side to move
+void record(SelfplayGame& g , long long score){
+    GameRecord& r = g.m.records[g.m.n++];
+    r.record.black = g.cur.bits[OthelloBoard::BLACK];
+    r.record.white = g.cur.bits[OthelloBoard::WHITE];
+    r.record.score = clamp_score(score);
+    r.record.side = g.cur.cur_player;
+    r.record.game = g.id;
+    r.key = canonical_key(g.cur);
+}
+// plays the games first, first + step, ... below games, in_flight of them
+// at a time, and hands every finished one to sink. Each round all open
+// games make a move, the searches of the round run side by side in
+// search_many.
+void play_games(unsigned int first , unsigned int step , unsigned int games , int in_flight , \
+int depth , int random_plies , unsigned long long seed , const GameSink& sink){
+    std::vector<SelfplayGame> open;
+    unsigned int next = first;
+    std::vector<SearchTask> tasks;
+    std::vector<int> searched;
+    while(next < games || !open.empty()){
+        while((int)open.size() < in_flight && next < games){
+            open.emplace_back();
+            SelfplayGame& g = open.back();
+            g.id = next;
+            g.rng.seed(seed ^ (next * 0x9E3779B97F4A7C15ULL));
+            g.ply = 0;
+            g.m.n = 0;
+            next += step;
+        }
+        tasks.clear();
+        searched.clear();
+        for(size_t i=0;i<open.size();i++){
+            SelfplayGame& g = open[i];
+            g.cur.played_disc = g.cur.next_valid_spots[g.rng() % g.cur.next_valid_spots.size()];
+            if(g.ply < random_plies){
+                continue;
+            }
+            player = g.cur.cur_player;
+            nodes = 0;
+            node_limit = 0;
+            std::vector<RootLine> lines;
+            if(g.cur.disc_count[0] <= SELFPLAY_SOLVE_EMPTIES && solve_root(g.cur,lines)){
+                record(g,(long long)lines[0].score * NNUE_DISC_VALUE);
+                continue;
+            }
+            tasks.emplace_back(g.cur,g.cur.cur_player,depth);
+            searched.push_back(i);
+        }
+        search_many(tasks);
+        for(size_t t=0;t<tasks.size();t++){
+            SelfplayGame& g = open[searched[t]];
+            g.cur.played_disc = tasks[t].move;
+            record(g,tasks[t].score);
+        }
+        for(size_t i=0;i<open.size();){
+            SelfplayGame& g = open[i];
+            g.cur = play_move(g.cur,g.cur.played_disc);
+            g.ply++;
+            if(!g.cur.done){
+                i++;
+                continue;
+            }
+            signed char result = g.cur.disc_count[OthelloBoard::BLACK] - g.cur.disc_count[OthelloBoard::WHITE];
+            for(int k=0;k<g.m.n;k++){
+                g.m.records[k].record.result = result;
+            }
+            sink(g.m);
+            std::swap(open[i],open.back());
+            open.pop_back();
+        }
+    }
+}
+
+int main(int argc, char** argv){
+    if(argc < 2){
+        cerr << "usage: " << argv[0] << " <out> [games] [depth] [workers] [random plies] [seed] [games in flight]" << endl;
+        return 1;
+    }
+    unsigned int games = argc > 2 ? std::max(1,atoi(argv[2])) : 1000;
+    int depth = argc > 3 ? std::max(0,atoi(argv[3])) : 3;
+    int workers = argc > 4 ? std::max(1,atoi(argv[4])) : std::max(1u,std::thread::hardware_concurrency());
+    int random_plies = argc > 5 ? std::max(0,atoi(argv[5])) : 8;
+    unsigned long long seed = argc > 6 ? strtoull(argv[6],nullptr,10) : std::random_device()();
+    int in_flight = argc > 7 ? std::max(1,atoi(argv[7])) : 64;
+    std::ofstream out(argv[1],std::ios::binary);
+    if(!dataset_write_header(out)){
+        cerr << "can't write " << argv[1] << endl;
+        return 1;
+    }
+    // the workers' tables are private, a mapped MY_PROJECT_TT would be shared
+    unsetenv("MY_PROJECT_TT");
+    tt_init();
+    evaluator_init();
+    if(evaluator == EVAL_PATTERNS){
+        pattern_init();
+    }
+    if(evaluator == EVAL_NNUE){
+        nnue_init();
+    }
+    eval_cache_init();
+    std::ostream quiet(nullptr);
+    info = &quiet;
+
+    auto start = std::chrono::steady_clock::now();
+    auto last_report = start;
+    std::unordered_set<unsigned long long> seen;
+    long long positions = 0, written = 0, finished = 0;
+    GameSink keep = [&](const GameMessage& m){
+        for(int i=0;i<m.n;i++){
+            positions++;
+            if(seen.insert(m.records[i].key).second){
+                out.write(reinterpret_cast<const char*>(&m.records[i].record),sizeof(PositionRecord));
+                written++;
+            }
+        }
+        finished++;
+        auto now = std::chrono::steady_clock::now();
+        if(now - last_report > std::chrono::seconds(10)){
+            last_report = now;
+            cerr << "games " << finished << " positions " << positions << " unique " << written << endl;
+        }
+    };
+#ifdef HAVE_MMAP
+    int fd[2];
+    if(pipe(fd) != 0){
+        cerr << "can't create a pipe" << endl;
+        return 1;
+    }
+    std::vector<pid_t> children;
+    for(int w=0;w<workers;w++){
+        pid_t pid = fork();
+        if(pid == 0){
+            close(fd[0]);
+            GameSink send = [&](const GameMessage& m){
+                if(write(fd[1],&m,sizeof(m)) != (ssize_t)sizeof(m)){
+                    _exit(1);
+                }
+            };
+            play_games(w,workers,games,in_flight,depth,random_plies,seed,send);
+            _exit(0);
+        }
+        if(pid < 0){
+            cerr << "can't fork worker " << w << endl;
+            break;
+        }
+        children.push_back(pid);
+    }
+    close(fd[1]);
+    // the messages of the workers never interleave, but a read may end
+    // inside one
+    GameMessage m;
+    size_t got = 0;
+    ssize_t n;
+    while((n = read(fd[0],reinterpret_cast<char*>(&m) + got,sizeof(m) - got)) > 0){
+        got += n;
+        if(got == sizeof(m)){
+            keep(m);
+            got = 0;
+        }
+    }
+    close(fd[0]);
+    bool failed = (int)children.size() < workers;
+    for(pid_t pid:children){
+        int status;
+        waitpid(pid,&status,0);
+        failed = failed || !WIFEXITED(status) || WEXITSTATUS(status) != 0;
+    }
+    if(failed){
+        cerr << "a worker failed, the dataset is incomplete" << endl;
+    }
+#else
+    play_games(0,1,games,in_flight,depth,random_plies,seed,keep);
+#endif
+    out.flush();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    cerr << "games " << finished << " positions " << positions << " unique " << written << " " << seconds << " s " << \
+    (long long)(positions / std::max(seconds,1e-9) * 3600) << " positions/h" << endl;
+    return out ? 0 : 1;
+}
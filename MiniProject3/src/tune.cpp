@@ -0,0 +1,260 @@
+// Texel tuning of find_heuristic's phase weights on a dataset (dataset.h).
+// usage: ./tune <dataset> [epochs] [threads] [my_project.cpp to rewrite]
+//
+// find_heuristic is linear in the make_phase_weights arguments, so every
+// position is reduced once to its FEATURES term values, from both sides.
+// The weights of each phase are then fitted by Adam on the squared error
+// between sigmoid(k * score) and the game result (1 win, 0.5 draw, 0
+// loss), the samples split between the threads. k is fitted first with the
+// current weights. The tuned table is printed and, given a file, written
+// over phase_weights in it.
+#define MY_PROJECT_NO_MAIN
+#include "my_project.cpp"
+#include "dataset.h"
+#include <chrono>
+
+// the arguments of make_phase_weights, board as board / 2
+enum FEATURE {
+    F_HALF_BOARD,
+    F_BLACK_STABLE,
+    F_WHITE_STABLE,
+    F_MOTIVE,
+    F_NEXT_TO_CORNER,
+    F_BLACK_DISCS,
+    F_WHITE_DISCS,
+    FEATURES
+};
+// one position from one side
+struct TuneSample {
+    short f[FEATURES];
+    unsigned char phase;
+    // twice the result: 2 win, 1 draw, 0 loss
+    unsigned char result;
+};
+const int CHUNK = 65536;
+
+// the two samples of a record, black's first
+void extract(const PositionRecord& r , TuneSample* out){
+    std::array<std::array<int, 8>, 8> b;
+    for(int sq=0;sq<64;sq++){
+        b[sq / 8][sq % 8] = (r.black >> sq) & 1 ? OthelloBoard::BLACK : (r.white >> sq) & 1 ? OthelloBoard::WHITE : OthelloBoard::EMPTY;
+    }
+    OthelloBoard board(std::vector<Point>(),b,r.side);
+    board.next_valid_spots = board.get_valid_spots();
+    // find_heuristic's terms for black, with price doubled to keep the edge whole
+    int price_sum = 0;
+    for(int i=1;i<7;i++){
+        for(int j=1;j<7;j++){
+            price_sum += b[i][j] == OthelloBoard::BLACK ? price[i][j] : b[i][j] == OthelloBoard::WHITE ? -price[i][j] : 0;
+        }
+    }
+    int half_board = 2 * price_sum + board.edge_value<OthelloBoard::BLACK>();
+    std::array<unsigned long long, 3> stable_set = board.stable_discs();
+    int stable = __builtin_popcountll(stable_set[OthelloBoard::BLACK]) - __builtin_popcountll(stable_set[OthelloBoard::WHITE]);
+    int next_to_corner = 0;
+    const int corner[4][2] = {{0,0},{0,7},{7,0},{7,7}};
+    for(int k=0;k<4;k++){
+        int x = corner[k][0], y = corner[k][1];
+        if(b[x][y] == OthelloBoard::EMPTY){
+            int diagonal = b[x == 0 ? 1 : 6][y == 0 ? 1 : 6];
+            next_to_corner += diagonal == OthelloBoard::BLACK ? -1 : diagonal == OthelloBoard::WHITE ? 1 : 0;
+        }
+    }
+    int discs = board.disc_count[OthelloBoard::BLACK] - board.disc_count[OthelloBoard::WHITE];
+    for(int side=0;side<2;side++){
+        TuneSample& s = out[side];
+        int sign = side == 0 ? 1 : -1;
+        s.f[F_HALF_BOARD] = sign * half_board;
+        s.f[F_BLACK_STABLE] = side == 0 ? stable : 0;
+        s.f[F_WHITE_STABLE] = side == 1 ? -stable : 0;
+        // mobility of the side to move counts for both
+        s.f[F_MOTIVE] = board.next_valid_spots.size();
+        s.f[F_NEXT_TO_CORNER] = sign * next_to_corner;
+        s.f[F_BLACK_DISCS] = side == 0 ? discs : 0;
+        s.f[F_WHITE_DISCS] = side == 1 ? -discs : 0;
+        s.phase = game_phase(board.disc_count[OthelloBoard::EMPTY]);
+        int result = sign * r.result;
+        s.result = result > 0 ? 2 : result == 0 ? 1 : 0;
+    }
+}
+// weights[phase][feature], starting from phase_weights
+typedef std::array<std::array<double, FEATURES>, 3> Weights;
+Weights current_weights(){
+    Weights w;
+    for(int ph=0;ph<3;ph++){
+        const PhaseWeights& p = phase_weights[ph];
+        w[ph] = {(double)p.edge,(double)p.stable[1],(double)p.stable[2],(double)p.motive,\
+        (double)p.next_to_corner,(double)p.discs[1],(double)p.discs[2]};
+    }
+    return w;
+}
+double score(const Weights& w , const TuneSample& s){
+    double sum = 0;
+    for(int f=0;f<FEATURES;f++){
+        sum += w[s.phase][f] * s.f[f];
+    }
+    return sum;
+}
+double sigmoid(double x){
+    return 1 / (1 + std::exp(-x));
+}
+// mean squared error over the samples, and its gradient when grad is given
+double error(const std::vector<TuneSample>& samples , const Weights& w , double k , int threads , Weights* grad){
+    std::vector<double> sums(threads,0);
+    std::vector<Weights> grads(threads);
+    std::vector<std::thread> pool;
+    size_t per = (samples.size() + threads - 1) / threads;
+    for(int t=0;t<threads;t++){
+        pool.emplace_back([&,t](){
+            Weights& g = grads[t];
+            for(auto& row:g){
+                row.fill(0);
+            }
+            size_t first = std::min(samples.size(),t * per), last = std::min(samples.size(),first + per);
+            for(size_t i=first;i<last;i++){
+                const TuneSample& s = samples[i];
+                double p = sigmoid(k * score(w,s)), diff = p - s.result / 2.0;
+                sums[t] += diff * diff;
+                if(grad){
+                    double d = 2 * diff * p * (1 - p) * k;
+                    for(int f=0;f<FEATURES;f++){
+                        g[s.phase][f] += d * s.f[f];
+                    }
+                }
+            }
+        });
+    }
+    for(auto& th:pool){
+        th.join();
+    }
+    double sum = 0;
+    if(grad){
+        for(auto& row:*grad){
+            row.fill(0);
+        }
+    }
+    for(int t=0;t<threads;t++){
+        sum += sums[t];
+        for(int ph=0;grad && ph<3;ph++){
+            for(int f=0;f<FEATURES;f++){
+                (*grad)[ph][f] += grads[t][ph][f] / samples.size();
+            }
+        }
+    }
+    return sum / samples.size();
+}
+std::string table(const Weights& w){
+    std::ostringstream out;
+    out << "constexpr PhaseWeights phase_weights[3] = {\n";
+    for(int ph=0;ph<3;ph++){
+        out << "    make_phase_weights(";
+        for(int f=0;f<FEATURES;f++){
+            out << (f ? "," : "") << lround(w[ph][f]) * (f == F_HALF_BOARD ? 2 : 1);
+        }
+        out << ")" << (ph < 2 ? "," : "") << "\n";
+    }
+    out << "};";
+    return out.str();
+}
+// replace the phase_weights table of the engine source, keeping its line ends
+bool rewrite(const char* path , const Weights& w){
+    std::ifstream in(path,std::ios::binary);
+    std::stringstream buffer;
+    buffer << in.rdbuf();
+    std::string text = buffer.str();
+    size_t first = text.find("constexpr PhaseWeights phase_weights[3] = {");
+    size_t last = first == std::string::npos ? first : text.find("};",first);
+    if(last == std::string::npos){
+        return false;
+    }
+    std::string replacement = table(w);
+    if(text.find("\r\n") != std::string::npos){
+        for(size_t pos=0;(pos = replacement.find('\n',pos)) != std::string::npos;pos+=2){
+            replacement.replace(pos,1,"\r\n");
+        }
+    }
+    text.replace(first,last + 2 - first,replacement);
+    std::ofstream out(path,std::ios::binary);
+    out << text;
+    return (bool)out;
+}
+
+int main(int argc, char** argv){
+    if(argc < 2){
+        cerr << "usage: " << argv[0] << " <dataset> [epochs] [threads] [my_project.cpp to rewrite]" << endl;
+        return 1;
+    }
+    int epochs = argc > 2 ? std::max(1,atoi(argv[2])) : 200;
+    int threads = argc > 3 ? std::max(1,atoi(argv[3])) : std::max(1u,std::thread::hardware_concurrency());
+    auto start = std::chrono::steady_clock::now();
+    DatasetReader reader;
+    if(!reader.open(argv[1])){
+        cerr << "can't read dataset " << argv[1] << endl;
+        return 1;
+    }
+    std::vector<TuneSample> samples;
+    std::vector<PositionRecord> chunk(CHUNK);
+    size_t n;
+    while((n = reader.read(chunk.data(),CHUNK)) > 0){
+        size_t base = samples.size();
+        samples.resize(base + 2 * n);
+        std::vector<std::thread> pool;
+        for(int t=0;t<threads;t++){
+            pool.emplace_back([&,t](){
+                for(size_t i=t;i<n;i+=threads){
+                    extract(chunk[i],&samples[base + 2 * i]);
+                }
+            });
+        }
+        for(auto& th:pool){
+            th.join();
+        }
+    }
+    if(samples.empty()){
+        cerr << "no positions in " << argv[1] << endl;
+        return 1;
+    }
+    cout << "samples " << samples.size() << " loaded in " << \
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() << " s" << endl;
+    Weights w = current_weights();
+    // k by golden section search, the sigmoid's scale for the current weights
+    double lo = 1e-6, hi = 1e-2;
+    const double golden = (std::sqrt(5.0) - 1) / 2;
+    for(int i=0;i<60;i++){
+        double a = hi - golden * (hi - lo), b = lo + golden * (hi - lo);
+        if(error(samples,w,a,threads,nullptr) < error(samples,w,b,threads,nullptr)){
+            hi = b;
+        }
+        else{
+            lo = a;
+        }
+    }
+    double k = (lo + hi) / 2;
+    cout << "k " << k << " error " << error(samples,w,k,threads,nullptr) << endl;
+    // Adam normalises every gradient, so terms of very different scales
+    // move at the same rate of about rate per epoch
+    Weights m = Weights(), v = Weights(), grad;
+    const double beta1 = 0.9, beta2 = 0.999, rate = 0.5;
+    for(int epoch=1;epoch<=epochs;epoch++){
+        auto epoch_start = std::chrono::steady_clock::now();
+        double e = error(samples,w,k,threads,&grad);
+        double correction = std::sqrt(1 - std::pow(beta2,epoch)) / (1 - std::pow(beta1,epoch));
+        for(int ph=0;ph<3;ph++){
+            for(int f=0;f<FEATURES;f++){
+                m[ph][f] = beta1 * m[ph][f] + (1 - beta1) * grad[ph][f];
+                v[ph][f] = beta2 * v[ph][f] + (1 - beta2) * grad[ph][f] * grad[ph][f];
+                w[ph][f] -= rate * correction * m[ph][f] / (std::sqrt(v[ph][f]) + 1e-12);
+            }
+        }
+        if(epoch % 10 == 0 || epoch == epochs){
+            cout << "epoch " << epoch << " error " << e << " " << \
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - epoch_start).count() << " s" << endl;
+        }
+    }
+    cout << table(w) << endl;
+    if(argc > 4 && !rewrite(argv[4],w)){
+        cerr << "can't rewrite phase_weights in " << argv[4] << endl;
+        return 1;
+    }
+    return 0;
+}
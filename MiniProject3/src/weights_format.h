@@ -0,0 +1,105 @@
+// Binary weights file shared by my_project and the tools that write it.
+//
+// layout: a WeightsHeader, the section table right after it, then the data
+// of every section starting on a WEIGHTS_ALIGN boundary. Everything is
+// little endian and used in place, the engine maps the file read-only and
+// points into it.
+#ifndef WEIGHTS_FORMAT_H
+#define WEIGHTS_FORMAT_H
+
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+const char WEIGHTS_MAGIC[8] = {'O','T','H','E','L','L','W','T'};
+const unsigned int WEIGHTS_VERSION = 1;
+const unsigned long long WEIGHTS_ALIGN = 64;
+
+enum WEIGHT_TYPE {
+    WEIGHT_I8 = 1,
+    WEIGHT_I16 = 2,
+    WEIGHT_I32 = 4     // the values are the element sizes
+};
+struct WeightsHeader {
+    char magic[8];
+    unsigned int version;
+    unsigned int sections;
+    // size of the whole file
+    unsigned long long bytes;
+};
+struct WeightsSection {
+    char name[16];
+    unsigned int type;
+    unsigned int pad;
+    // from the start of the file, a multiple of WEIGHTS_ALIGN
+    unsigned long long offset;
+    unsigned long long count;
+};
+
+// the data of section name if the file holds it with this type and count,
+// nullptr otherwise. base and bytes are the whole file.
+inline const void* weights_find(const void* base , unsigned long long bytes , const char* name , \
+unsigned int type , unsigned long long count){
+    const char* file = static_cast<const char*>(base);
+    if(bytes < sizeof(WeightsHeader)){
+        return nullptr;
+    }
+    const WeightsHeader* header = reinterpret_cast<const WeightsHeader*>(file);
+    if(memcmp(header->magic,WEIGHTS_MAGIC,sizeof(WEIGHTS_MAGIC)) != 0 || header->version != WEIGHTS_VERSION || \
+    header->bytes != bytes || sizeof(WeightsHeader) + header->sections * sizeof(WeightsSection) > bytes){
+        return nullptr;
+    }
+    const WeightsSection* table = reinterpret_cast<const WeightsSection*>(file + sizeof(WeightsHeader));
+    for(unsigned int i=0;i<header->sections;i++){
+        const WeightsSection& s = table[i];
+        if(strncmp(s.name,name,sizeof(s.name)) != 0){
+            continue;
+        }
+        if(s.type != type || s.count != count || s.offset % WEIGHTS_ALIGN != 0 || \
+        s.offset > bytes || count * type > bytes - s.offset){
+            return nullptr;
+        }
+        return file + s.offset;
+    }
+    return nullptr;
+}
+
+// one section to write, data holds count * type bytes
+struct WeightsBlob {
+    std::string name;
+    unsigned int type;
+    unsigned long long count;
+    const void* data;
+};
+// write a whole weights file, false if out failed
+inline bool weights_write(std::ostream& out , const std::vector<WeightsBlob>& blobs){
+    std::vector<WeightsSection> table(blobs.size());
+    unsigned long long offset = sizeof(WeightsHeader) + blobs.size() * sizeof(WeightsSection);
+    for(size_t i=0;i<blobs.size();i++){
+        offset = (offset + WEIGHTS_ALIGN - 1) / WEIGHTS_ALIGN * WEIGHTS_ALIGN;
+        memset(&table[i],0,sizeof(WeightsSection));
+        strncpy(table[i].name,blobs[i].name.c_str(),sizeof(table[i].name) - 1);
+        table[i].type = blobs[i].type;
+        table[i].offset = offset;
+        table[i].count = blobs[i].count;
+        offset += blobs[i].count * blobs[i].type;
+    }
+    WeightsHeader header;
+    memcpy(header.magic,WEIGHTS_MAGIC,sizeof(WEIGHTS_MAGIC));
+    header.version = WEIGHTS_VERSION;
+    header.sections = blobs.size();
+    header.bytes = offset;
+    out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+    out.write(reinterpret_cast<const char*>(table.data()),table.size() * sizeof(WeightsSection));
+    unsigned long long written = sizeof(WeightsHeader) + blobs.size() * sizeof(WeightsSection);
+    const char zeros[WEIGHTS_ALIGN] = {0};
+    for(size_t i=0;i<blobs.size();i++){
+        out.write(zeros,table[i].offset - written);
+        out.write(static_cast<const char*>(blobs[i].data),blobs[i].count * blobs[i].type);
+        written = table[i].offset + blobs[i].count * blobs[i].type;
+    }
+    return (bool)out;
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Packs raw little endian arrays into a weights file (weights_format.h).
+// usage: ./weights_pack <out> <name>:<i8|i16|i32>:<raw file> ...
+// e.g. the old raw pattern weights:
+//        ./weights_pack patterns.w patterns:i16:patterns.raw
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "weights_format.h"
+
+using namespace std;
+
+int main(int argc, char** argv){
+    if(argc < 3){
+        cerr << "usage: " << argv[0] << " <out> <name>:<i8|i16|i32>:<raw file> ..." << endl;
+        return 1;
+    }
+    std::vector<std::string> data(argc - 2);
+    std::vector<WeightsBlob> blobs;
+    for(int i=2;i<argc;i++){
+        std::string arg = argv[i];
+        size_t first = arg.find(':'), second = arg.find(':',first + 1);
+        if(first == std::string::npos || second == std::string::npos){
+            cerr << "bad section " << arg << endl;
+            return 1;
+        }
+        std::string name = arg.substr(0,first), type = arg.substr(first + 1,second - first - 1);
+        unsigned int size = type == "i8" ? WEIGHT_I8 : type == "i16" ? WEIGHT_I16 : type == "i32" ? WEIGHT_I32 : 0;
+        if(size == 0 || name.empty() || name.size() >= sizeof(WeightsSection().name)){
+            cerr << "bad section " << arg << endl;
+            return 1;
+        }
+        std::ifstream in(arg.substr(second + 1),std::ios::binary);
+        std::stringstream buffer;
+        buffer << in.rdbuf();
+        if(!in){
+            cerr << "can't read " << arg.substr(second + 1) << endl;
+            return 1;
+        }
+        data[i-2] = buffer.str();
+        if(data[i-2].size() % size != 0){
+            cerr << arg.substr(second + 1) << " is not a whole number of " << type << endl;
+            return 1;
+        }
+        blobs.push_back(WeightsBlob{name,size,data[i-2].size() / size,data[i-2].data()});
+    }
+    std::ofstream out(argv[1],std::ios::binary);
+    if(!weights_write(out,blobs)){
+        cerr << "can't write " << argv[1] << endl;
+        return 1;
+    }
+    return 0;
+}